@@ -0,0 +1,1094 @@
+/** 
+ * --------------------------------------------------------------------------------------------+ 
+ * @desc        Benchmark of drawing primitives and flush paths (host build)
+ * --------------------------------------------------------------------------------------------+ 
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        bench.c
+ * @tested      Linux gcc
+ *
+ * @depend      pcd8544.h, emulator.h
+ * --------------------------------------------------------------------------------------------+
+ * @usage       bench <results> [baseline]
+ *              Runs fixed workloads against emulated controller, writes lines
+ *              "<workload> <metric> <value>" into results and compares them with
+ *              baseline. Exit code 1 if any metric regresses beyond tolerance.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../lib/pcd8544.h"
+#include "prop5x7.h"
+#include "big10x16.h"
+
+// Workload timing repetitions (minimum is taken)
+#define BENCH_REPEAT      5
+
+// Maximum number of baseline / tolerance entries
+#define BENCH_ENTRIES     256
+
+// Default tolerance of metric without tolerance line [%]
+#define BENCH_TOLERANCE   0.0
+
+// @type Workload
+typedef struct {
+  // name
+  const char *name;
+  // workload function
+  void (*run)(void);
+  // flushes per second of timer paced workload, 0 if not paced
+  uint16_t hz;
+} Workload;
+
+// @type Measured metrics
+typedef struct {
+  uint32_t flushes;
+  uint32_t fbWrites;
+  uint32_t commands;
+  uint32_t data;
+  double ns;
+} Metrics;
+
+// @type Baseline entry
+typedef struct {
+  char workload[32];
+  char metric[32];
+  double value;
+} Entry;
+
+// @var Flushes of current workload
+static uint32_t benchFlushes;
+
+// @var Pseudo random generator state
+static uint32_t benchSeed;
+
+// @var Compressed images of current workload [bytes], 0 if none
+static uint32_t benchImageBytes;
+
+// @var Fonts of current workload [bytes], 0 if built-in only
+static uint32_t benchFontBytes;
+
+// @var Glyphs drawn by current workload, 0 if not counted
+static uint32_t benchGlyphs;
+
+// @var Polygons filled by current workload, 0 if not counted
+static uint32_t benchFills;
+
+/**
+ * @desc    Deterministic pseudo random number (LCG)
+ *
+ * @param   uint32_t range
+ *
+ * @return  uint32_t - 0 <= value < range
+ */
+static uint32_t BENCH_Random (uint32_t range)
+{
+  benchSeed = benchSeed * 1103515245u + 12345u;
+  return (benchSeed >> 16) % range;
+}
+
+/**
+ * @desc    Flush to emulated controller
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_Flush (void)
+{
+  benchFlushes++;
+  PCD8544_UpdateScreen ();
+}
+
+/**
+ * @desc    Full screen text page - 6 rows x 14 characters, 20 pages
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_TextPage (void)
+{
+  char line[15];
+  uint8_t page, row, col;
+
+  for (page = 0; page < 20; page++) {
+    PCD8544_ClearScreen ();
+    for (row = 0; row < MAX_NUM_ROWS; row++) {
+      for (col = 0; col < 14; col++) {
+        line[col] = 0x21 + ((page + row * 14 + col) % 94);
+      }
+      line[14] = '\0';
+      PCD8544_SetTextPosition (row, 0);
+      PCD8544_DrawString (line);
+    }
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Random line field - 10 frames x 100 segments
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_LineField (void)
+{
+  uint8_t frame, i;
+
+  for (frame = 0; frame < 10; frame++) {
+    PCD8544_ClearScreen ();
+    for (i = 0; i < 100; i++) {
+      PCD8544_DrawLine (BENCH_Random (MAX_NUM_COLS), BENCH_Random (MAX_NUM_COLS),
+                        BENCH_Random (MAX_NUM_ROWS * 8), BENCH_Random (MAX_NUM_ROWS * 8));
+    }
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Scrolling strip chart - 200 samples, plot area redrawn per sample
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_StripChart (void)
+{
+  uint8_t samples[MAX_NUM_COLS];
+  uint16_t n;
+  uint8_t i;
+
+  memset (samples, 24, sizeof(samples));
+  PCD8544_ClearScreen ();
+  for (n = 0; n < 200; n++) {
+    // shift samples, append new one
+    memmove (samples, samples + 1, MAX_NUM_COLS - 1);
+    samples[MAX_NUM_COLS - 1] = 8 + BENCH_Random (32);
+    // redraw plot area
+    PCD8544_FillRect (0, 8, MAX_NUM_COLS, 40, PCD8544_OP_CLR);
+    for (i = 0; i < (MAX_NUM_COLS - 1); i++) {
+      PCD8544_DrawLine (i, i + 1, samples[i], samples[i + 1]);
+    }
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Single digit updates - 100 updates of one character
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_DigitUpdates (void)
+{
+  uint8_t i;
+
+  PCD8544_ClearScreen ();
+  PCD8544_SetTextPosition (2, 0);
+  PCD8544_DrawString ("Value:");
+  BENCH_Flush ();
+  for (i = 0; i < 100; i++) {
+    PCD8544_SetTextPosition (2, 7);
+    PCD8544_DrawChar ('0' + (i % 10));
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Bar graph - 10 bars of 6 columns, one bar changes per flush,
+ *          200 updates
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_BarGraph (void)
+{
+  uint8_t n, bar, level;
+
+  PCD8544_ClearScreen ();
+  BENCH_Flush ();
+  for (n = 0; n < 200; n++) {
+    bar = BENCH_Random (10);
+    level = BENCH_Random (MAX_NUM_ROWS * 8 + 1);
+    // empty part and filled part of bar
+    PCD8544_FillRect (bar * 8 + 2, 0, 6, MAX_NUM_ROWS * 8 - level, PCD8544_OP_CLR);
+    PCD8544_FillRect (bar * 8 + 2, MAX_NUM_ROWS * 8 - level, 6, level, PCD8544_OP_SET);
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Grayscale engine - 4 gray bars, 300 timer ticks (100 gray cycles),
+ *          each tick counted as flush, transfer completed before next tick
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_GrayCycle (void)
+{
+  static uint8_t plane[CACHE_SIZE_MEM];
+  uint16_t n;
+  uint8_t level;
+
+  memset (plane, 0x00, sizeof(plane));
+  PCD8544_ClearScreen ();
+  PCD8544_GrayStart (plane);
+  for (level = PCD8544_GRAY_WHITE; level <= PCD8544_GRAY_BLACK; level++) {
+    PCD8544_GrayFillRect (level * 21, 0, 21, MAX_NUM_ROWS * 8, level);
+  }
+  for (n = 0; n < 300; n++) {
+    benchFlushes++;
+    PCD8544_GrayTick ();
+    // frame sent in background
+    while (PCD8544_IsBusy ()) {
+      PCD8544_EmuService ();
+    }
+  }
+  PCD8544_GrayStop ();
+}
+
+/**
+ * @desc    RLE compress - literal packets and runs of 3 - 130 bytes
+ *          (same format as img2pcd -r)
+ *
+ * @param   const uint8_t * - in
+ * @param   uint16_t - length
+ * @param   uint8_t * - out, length + length / 128 + 1 bytes
+ *
+ * @return  uint16_t - compressed length
+ */
+static uint16_t BENCH_Rle (const uint8_t *in, uint16_t len, uint8_t *out)
+{
+  uint16_t i = 0, n = 0, run;
+  int16_t literal = -1;
+
+  while (i < len) {
+    // length of run at i
+    run = 1;
+    while ((i + run < len) && (run < 130) && (in[i + run] == in[i])) {
+      run++;
+    }
+    if (run >= 3) {
+      // run packet
+      out[n++] = 0x80 | (run - 3);
+      out[n++] = in[i];
+      i += run;
+      literal = -1;
+    } else {
+      // open new literal packet or extend current
+      if ((literal < 0) || (out[literal] == 0x7F)) {
+        literal = n;
+        out[n++] = 0xFF;
+      }
+      out[literal]++;
+      out[n++] = in[i++];
+    }
+  }
+  return n;
+}
+
+/**
+ * @desc    RLE images streamed to controller - splash screen and text page
+ *          compressed once (not counted), shown alternately 40 times,
+ *          cache updated on the fly
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_RleSplash (void)
+{
+  static uint8_t images[2][CACHE_SIZE_MEM + CACHE_SIZE_MEM / 128 + 1];
+  static uint16_t lengths[2];
+  uint8_t n;
+
+  if (!lengths[0]) {
+    // splash - frame, title and progress bar
+    PCD8544_ClearScreen ();
+    PCD8544_DrawRect (0, 0, MAX_NUM_COLS, MAX_NUM_ROWS * 8, PCD8544_OP_SET);
+    PCD8544_SetTextPosition (1, 14);
+    PCD8544_DrawString ("PCD8544");
+    PCD8544_FillRect (8, 32, 68, 6, PCD8544_OP_SET);
+    PCD8544_UpdateScreen ();
+    lengths[0] = BENCH_Rle (&pcd8544Emu.ddram[0][0], CACHE_SIZE_MEM, images[0]);
+    // text page
+    BENCH_TextPage ();
+    lengths[1] = BENCH_Rle (&pcd8544Emu.ddram[0][0], CACHE_SIZE_MEM, images[1]);
+    // preparation not counted
+    PCD8544_EmuResetCounters ();
+    pcd8544FbWrites = 0;
+    benchFlushes = 0;
+  }
+  benchImageBytes = lengths[0] + lengths[1];
+  for (n = 0; n < 40; n++) {
+    benchFlushes++;
+    PCD8544_DrawImageRle (images[n & 1], 0, 0, MAX_NUM_COLS, MAX_NUM_ROWS, PCD8544_IMAGE_CACHE);
+  }
+}
+
+/**
+ * @desc    Proportional text - 20 pages of 2 bank clock (digits subset of
+ *          large font) and 80 characters of wrapped proportional text
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_PropText (void)
+{
+  char clock[6];
+  char text[81];
+  uint8_t page, i;
+
+  benchFontBytes = PROP5X7_SIZE + BIG10X16_SIZE;
+  for (page = 0; page < 20; page++) {
+    PCD8544_ClearScreen ();
+    // clock
+    sprintf (clock, "%02d:%02d", page, page * 3);
+    PCD8544_SetFont (&big10x16);
+    PCD8544_SetPixelPosition (0, 0);
+    PCD8544_DrawString (clock);
+    // text below, wrapped
+    for (i = 0; i < 80; i++) {
+      text[i] = 0x21 + ((page + i) % 94);
+    }
+    text[80] = '\0';
+    PCD8544_SetFont (&prop5x7);
+    PCD8544_SetPixelPosition (BIG10X16_HEIGHT, 0);
+    PCD8544_DrawString (text);
+    BENCH_Flush ();
+  }
+  PCD8544_SetFont (0);
+}
+
+/**
+ * @desc    Glyph lookup - 20 pages, 4 passes over 6 rows of 12 glyphs
+ *
+ * @param   const char * - 12 glyphs, UTF-8
+ *
+ * @return  void
+ */
+static void BENCH_Glyphs (const char *glyphs)
+{
+  uint8_t page, pass, row;
+
+  benchFontBytes = PROP5X7_SIZE;
+  PCD8544_SetFont (&prop5x7);
+  for (page = 0; page < 20; page++) {
+    PCD8544_ClearScreen ();
+    for (pass = 0; pass < 4; pass++) {
+      for (row = 0; row < MAX_NUM_ROWS; row++) {
+        PCD8544_SetPixelPosition (row * 8, 0);
+        PCD8544_DrawString ((char *) glyphs);
+        benchGlyphs += 12;
+      }
+    }
+    BENCH_Flush ();
+  }
+  PCD8544_SetFont (0);
+}
+
+/**
+ * @desc    ASCII glyphs - direct index (base letters of utf8_glyphs)
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_AsciiGlyphs (void)
+{
+  BENCH_Glyphs ("zltcyunuedae");
+}
+
+/**
+ * @desc    Central European glyphs - UTF-8 decoding, sparse map search
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_Utf8Glyphs (void)
+{
+  BENCH_Glyphs ("\u017e\u013e\u0165\u010d\u00fd\u016f\u0148\u00fa\u011b\u010f\u00e1\u00e9");
+}
+
+/**
+ * @desc    Number readouts formatted by sprintf - counter, temperature,
+ *          voltage redrawn as strings, 200 updates
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_NumberSprintf (void)
+{
+  char text[8];
+  uint16_t i;
+
+  for (i = 0; i < 200; i++) {
+    sprintf (text, "%6u", i);
+    PCD8544_SetTextPosition (0, 0);
+    PCD8544_DrawString (text);
+    sprintf (text, "%3d.%d", (215 + (i / 10) % 7) / 10, (215 + (i / 10) % 7) % 10);
+    PCD8544_SetTextPosition (2, 0);
+    PCD8544_DrawString (text);
+    sprintf (text, "%d.%03d", (3300 - i * 3) / 1000, (3300 - i * 3) % 1000);
+    PCD8544_SetTextPosition (4, 0);
+    PCD8544_DrawString (text);
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Number readouts in fields - same values as number_sprintf,
+ *          changed cells and bytes only, 200 updates
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_NumberFields (void)
+{
+  pcd8544_field_t counter = PCD8544_FIELD (0, 0, 6, PCD8544_FIELD_RIGHT);
+  pcd8544_field_t temperature = PCD8544_FIELD (0, 16, 5, PCD8544_FIELD_RIGHT);
+  pcd8544_field_t voltage = PCD8544_FIELD (0, 32, 5, PCD8544_FIELD_RIGHT);
+  uint16_t i;
+
+  for (i = 0; i < 200; i++) {
+    PCD8544_DrawInt (&counter, i);
+    PCD8544_DrawFixed (&temperature, 215 + (i / 10) % 7, 1);
+    PCD8544_DrawFixed (&voltage, 3300 - i * 3, 3);
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Rolling log - 200 lines on console, flush after each line,
+ *          then 84 characters typed with flush after each one
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_ConsoleLog (void)
+{
+  pcd8544_console_t console;
+  char line[16];
+  uint16_t i;
+
+  PCD8544_ConsoleClear (&console);
+  for (i = 0; i < 200; i++) {
+    sprintf (line, "\nt=%u %s", i * 25, (i % 7) ? "ok" : "retry");
+    PCD8544_ConsolePuts (&console, line);
+    benchFlushes++;
+    PCD8544_ConsoleFlush (&console);
+  }
+  for (i = 0; i < 84; i++) {
+    PCD8544_ConsolePutc (&console, 0x21 + i);
+    benchFlushes++;
+    PCD8544_ConsoleFlush (&console);
+  }
+}
+
+/**
+ * @desc    Strip chart widget - samples of strip_chart pushed into ring,
+ *          one column rendered per sample, 200 updates
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_ChartRing (void)
+{
+  uint8_t columns[5 * MAX_NUM_COLS];
+  pcd8544_chart_t chart = PCD8544_CHART (columns, 0, 1, MAX_NUM_COLS, 5, PCD8544_CHART_LINE);
+  uint16_t n;
+
+  PCD8544_ChartClear (&chart);
+  PCD8544_ClearScreen ();
+  for (n = 0; n < 200; n++) {
+    // same rows as strip_chart, value 0 is bottom row
+    PCD8544_ChartPush (&chart, 39 - BENCH_Random (32));
+    PCD8544_DrawChart (&chart);
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Text ticker - 5 rows scrolled up one pixel per flush, new row
+ *          drawn every 8 pixels, 200 updates
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_TickerScroll (void)
+{
+  char line[15];
+  uint16_t n;
+
+  PCD8544_ClearScreen ();
+  PCD8544_SetTextPosition (0, 0);
+  PCD8544_DrawString ("Ticker");
+  for (n = 0; n < 200; n++) {
+    PCD8544_ScrollRegion (0, 8, MAX_NUM_COLS, 40, -1);
+    // bottom row vacated
+    if ((n & 0x07) == 0x07) {
+      sprintf (line, "news item %3u", n >> 3);
+      PCD8544_SetTextPosition (5, 0);
+      PCD8544_DrawString (line);
+    }
+    BENCH_Flush ();
+  }
+}
+
+// @const Sprite image 8x8 - ball with highlight
+static const uint8_t benchBall[8] = {
+  0x3C, 0x42, 0x8D, 0x8D, 0x81, 0x81, 0x42, 0x3C
+};
+
+// @const Sprite mask 8x8 - disc
+static const uint8_t benchBallMask[8] = {
+  0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C
+};
+
+/**
+ * @desc    Background of sprite workloads - text in rows 1 - 5
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_SpriteBackground (void)
+{
+  uint8_t row;
+
+  PCD8544_SetTextPosition (0, 0);
+  PCD8544_DrawString ("Sprites");
+  for (row = 1; row < MAX_NUM_ROWS; row++) {
+    PCD8544_SetTextPosition (row, 0);
+    PCD8544_DrawString ("..:..:..:..:..");
+  }
+}
+
+/**
+ * @desc    Step of bouncing sprite
+ *
+ * @param   int16_t * - position
+ * @param   int8_t * - velocity
+ * @param   int16_t - maximal position
+ *
+ * @return  void
+ */
+static void BENCH_Bounce (int16_t *pos, int8_t *vel, int16_t max)
+{
+  *pos += *vel;
+  if ((*pos < 0) || (*pos > max)) {
+    *vel = -*vel;
+    *pos += 2 * *vel;
+  }
+}
+
+/**
+ * @desc    8 bouncing sprites redrawn with whole frame - clear,
+ *          background, sprites, 100 frames
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_SpritesRedraw (void)
+{
+  int16_t x[8], y[8];
+  int8_t vx[8], vy[8];
+  uint8_t frame, i;
+
+  for (i = 0; i < 8; i++) {
+    x[i] = i * 9;
+    y[i] = 8 + i * 4;
+    vx[i] = 1 + (i & 1);
+    vy[i] = (i & 2) ? 1 : -1;
+  }
+  for (frame = 0; frame < 100; frame++) {
+    PCD8544_ClearScreen ();
+    BENCH_SpriteBackground ();
+    for (i = 0; i < 8; i++) {
+      BENCH_Bounce (&x[i], &vx[i], MAX_NUM_COLS - 8);
+      BENCH_Bounce (&y[i], &vy[i], MAX_NUM_ROWS * 8 - 8);
+      PCD8544_DrawBitmapMasked (benchBall, benchBallMask, x[i], y[i], 8, 8);
+    }
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    8 bouncing sprites of sprites_redraw on sprite layer -
+ *          background drawn once, 100 frames
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_SpritesLayer (void)
+{
+  static uint8_t save[8][PCD8544_SPRITE_SAVE (8, 8)];
+  pcd8544_sprite_t sprites[8];
+  int8_t vx[8], vy[8];
+  uint8_t frame, i;
+
+  for (i = 0; i < 8; i++) {
+    sprites[i] = (pcd8544_sprite_t) PCD8544_SPRITE (benchBall, benchBallMask, save[i], 8, 8);
+    sprites[i].x = i * 9;
+    sprites[i].y = 8 + i * 4;
+    sprites[i].visible = 1;
+    vx[i] = 1 + (i & 1);
+    vy[i] = (i & 2) ? 1 : -1;
+  }
+  PCD8544_ClearScreen ();
+  BENCH_SpriteBackground ();
+  for (frame = 0; frame < 100; frame++) {
+    for (i = 0; i < 8; i++) {
+      BENCH_Bounce (&sprites[i].x, &vx[i], MAX_NUM_COLS - 8);
+      BENCH_Bounce (&sprites[i].y, &vy[i], MAX_NUM_ROWS * 8 - 8);
+    }
+    PCD8544_DrawSprites (sprites, 8);
+    BENCH_Flush ();
+  }
+}
+
+// @const Cosine of 0 - 90 degrees in 8 steps scaled 64
+static const int8_t benchCos[9] = {
+  64, 63, 59, 53, 45, 36, 24, 12, 0
+};
+
+/**
+ * @desc    Point on circle in one of 32 directions (y axis up)
+ *
+ * @param   uint8_t step - direction 0 - 31, 0 at 3 o'clock
+ * @param   uint8_t r - radius
+ * @param   char * x - column
+ * @param   char * y - row
+ *
+ * @return  void
+ */
+static void BENCH_Dial (uint8_t step, uint8_t r, char *x, char *y)
+{
+  uint8_t rest = step & 0x07;
+  int16_t cosine = benchCos[rest];
+  int16_t sinus = benchCos[8 - rest];
+  int16_t dx, dy;
+
+  switch ((step >> 3) & 0x03) {
+    case 0: dx = cosine; dy = sinus; break;
+    case 1: dx = -sinus; dy = cosine; break;
+    case 2: dx = -cosine; dy = -sinus; break;
+    default: dx = sinus; dy = -cosine; break;
+  }
+  *x = 42 + (dx * r + 32) / 64;
+  *y = 24 - (dy * r + 32) / 64;
+}
+
+/**
+ * @desc    Dial gauge of line segments - 32 segment bezel, 24 segment
+ *          scale, hub of vertical chords, needle, 100 updates
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_GaugeLines (void)
+{
+  char x0, y0, x1, y1;
+  uint8_t n, i;
+
+  for (n = 0; n < 100; n++) {
+    PCD8544_ClearScreen ();
+    // bezel and scale 225 .. -45 degrees
+    for (i = 0; i < 32; i++) {
+      BENCH_Dial (i, 23, &x0, &y0);
+      BENCH_Dial (i + 1, 23, &x1, &y1);
+      PCD8544_DrawLine (x0, x1, y0, y1);
+      if ((i < 20) || (i >= 28)) {
+        BENCH_Dial (i, 19, &x0, &y0);
+        BENCH_Dial (i + 1, 19, &x1, &y1);
+        PCD8544_DrawLine (x0, x1, y0, y1);
+      }
+    }
+    // hub
+    for (i = 0; i < 7; i++) {
+      PCD8544_DrawLine (39 + i, 39 + i, 21 + (i == 0 || i == 6), 27 - (i == 0 || i == 6));
+    }
+    // needle
+    BENCH_Dial (20 - (n % 25), 17, &x1, &y1);
+    PCD8544_DrawLine (42, x1, 24, y1);
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Dial gauge of circles - bezel circle, scale arc, filled hub,
+ *          needle, 100 updates
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_GaugeShapes (void)
+{
+  char x1, y1;
+  uint8_t n;
+
+  for (n = 0; n < 100; n++) {
+    PCD8544_ClearScreen ();
+    // bezel and scale 225 .. -45 degrees
+    PCD8544_DrawCircle (42, 24, 23, PCD8544_OP_SET);
+    PCD8544_DrawArc (42, 24, 19, -45, 225, PCD8544_OP_SET);
+    // hub
+    PCD8544_FillCircle (42, 24, 3, PCD8544_OP_SET);
+    // needle
+    BENCH_Dial (20 - (n % 25), 17, &x1, &y1);
+    PCD8544_DrawLine (42, x1, 24, y1);
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Random triangles - 20 per flush filled by XOR, vertices up to
+ *          20 pixels outside display, 100 updates
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_TriangleFill (void)
+{
+  int16_t x[3], y[3];
+  uint8_t n, i, k;
+
+  for (n = 0; n < 100; n++) {
+    PCD8544_ClearScreen ();
+    for (i = 0; i < 20; i++) {
+      for (k = 0; k < 3; k++) {
+        x[k] = BENCH_Random (MAX_NUM_COLS + 40) - 20;
+        y[k] = BENCH_Random (MAX_NUM_ROWS * 8 + 40) - 20;
+      }
+      PCD8544_FillTriangle (x[0], y[0], x[1], y[1], x[2], y[2], PCD8544_OP_XOR);
+      benchFills++;
+    }
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Random pixels - 1000 per flush into framebuffer only, 10 updates
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_PixelField (void)
+{
+  uint16_t i;
+  uint8_t n;
+
+  for (n = 0; n < 10; n++) {
+    PCD8544_ClearScreen ();
+    for (i = 0; i < 1000; i++) {
+      PCD8544_DrawPixel (BENCH_Random (MAX_NUM_ROWS * 8), BENCH_Random (MAX_NUM_COLS));
+    }
+    BENCH_Flush ();
+  }
+}
+
+/**
+ * @desc    Raw frame send byte by byte - CE / DC toggled around every byte,
+ *          100 frames of 504 bytes
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_SendBytes (void)
+{
+  static uint8_t frame[CACHE_SIZE_MEM];
+  uint16_t i;
+  uint8_t n;
+
+  for (n = 0; n < 100; n++) {
+    for (i = 0; i < CACHE_SIZE_MEM; i++) {
+      frame[i] = BENCH_Random (256);
+    }
+    // Y address 0, X address 0
+    PCD8544_CommandSend (0x40);
+    PCD8544_CommandSend (0x80);
+    for (i = 0; i < CACHE_SIZE_MEM; i++) {
+      PCD8544_DataSend (frame[i]);
+    }
+    benchFlushes++;
+  }
+}
+
+/**
+ * @desc    Raw frame send in bursts - CE / DC asserted once per buffer,
+ *          100 frames of 504 bytes
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void BENCH_SendBurst (void)
+{
+  static uint8_t frame[CACHE_SIZE_MEM];
+  // Y address 0, X address 0
+  static const uint8_t address[] = { 0x40, 0x80 };
+  uint16_t i;
+  uint8_t n;
+
+  for (n = 0; n < 100; n++) {
+    for (i = 0; i < CACHE_SIZE_MEM; i++) {
+      frame[i] = BENCH_Random (256);
+    }
+    PCD8544_CommandSendBuffer (address, sizeof(address));
+    PCD8544_DataSendBuffer (frame, CACHE_SIZE_MEM);
+    benchFlushes++;
+  }
+}
+
+// @const Workloads
+static const Workload workloads[] = {
+  { "text_page",      BENCH_TextPage,      0               },
+  { "line_field",     BENCH_LineField,     0               },
+  { "strip_chart",    BENCH_StripChart,    0               },
+  { "digit_updates",  BENCH_DigitUpdates,  0               },
+  { "bar_graph",      BENCH_BarGraph,      0               },
+  { "gray_cycle",     BENCH_GrayCycle,     PCD8544_GRAY_HZ },
+  { "rle_splash",     BENCH_RleSplash,     0               },
+  { "prop_text",      BENCH_PropText,      0               },
+  { "ascii_glyphs",   BENCH_AsciiGlyphs,   0               },
+  { "utf8_glyphs",    BENCH_Utf8Glyphs,    0               },
+  { "number_sprintf", BENCH_NumberSprintf, 0               },
+  { "number_fields",  BENCH_NumberFields,  0               },
+  { "console_log",    BENCH_ConsoleLog,    0               },
+  { "chart_ring",     BENCH_ChartRing,     0               },
+  { "ticker_scroll",  BENCH_TickerScroll,  0               },
+  { "sprites_redraw", BENCH_SpritesRedraw, 0               },
+  { "sprites_layer",  BENCH_SpritesLayer,  0               },
+  { "gauge_lines",    BENCH_GaugeLines,    0               },
+  { "gauge_shapes",   BENCH_GaugeShapes,   0               },
+  { "triangle_fill",  BENCH_TriangleFill,  0               },
+  { "pixel_field",    BENCH_PixelField,    0               },
+  { "send_bytes",     BENCH_SendBytes,     0               },
+  { "send_burst",     BENCH_SendBurst,     0               }
+};
+
+/**
+ * @desc    Run workload on freshly initialised driver
+ *
+ * @param   const Workload *
+ * @param   Metrics *
+ *
+ * @return  void
+ */
+static void BENCH_Run (const Workload *workload, Metrics *metrics)
+{
+  struct timespec start, stop;
+  double ns;
+  uint8_t i;
+
+  for (i = 0; i < BENCH_REPEAT; i++) {
+    // same initial state and random sequence for each repetition
+    PCD8544_EmuReset ();
+    PCD8544_Init ();
+    PCD8544_ClearScreen ();
+    PCD8544_UpdateScreen ();
+    PCD8544_EmuResetCounters ();
+    pcd8544FbWrites = 0;
+    benchFlushes = 0;
+    benchImageBytes = 0;
+    benchFontBytes = 0;
+    benchGlyphs = 0;
+    benchFills = 0;
+    benchSeed = 1;
+    // measure
+    clock_gettime (CLOCK_MONOTONIC, &start);
+    workload->run ();
+    clock_gettime (CLOCK_MONOTONIC, &stop);
+    ns = (stop.tv_sec - start.tv_sec) * 1e9 + (stop.tv_nsec - start.tv_nsec);
+    // minimum time
+    if ((i == 0) || (ns < metrics->ns)) {
+      metrics->ns = ns;
+    }
+  }
+  // counters are deterministic
+  metrics->flushes = benchFlushes;
+  metrics->fbWrites = pcd8544FbWrites;
+  metrics->commands = pcd8544Emu.commands;
+  metrics->data = pcd8544Emu.data;
+}
+
+/**
+ * @desc    Load baseline - lines "<workload> <metric> <value>",
+ *          "tolerance <metric> <percent>", '#' comments
+ *
+ * @param   const char * - path
+ * @param   Entry * - entries
+ *
+ * @return  int - number of entries, -1 if not readable
+ */
+static int BENCH_LoadBaseline (const char *path, Entry *entries)
+{
+  char line[128];
+  int count = 0;
+  FILE *file = fopen (path, "r");
+
+  if (!file) {
+    return -1;
+  }
+  while (fgets (line, sizeof(line), file) && (count < BENCH_ENTRIES)) {
+    if ((line[0] == '#') || (line[0] == '\n')) {
+      continue;
+    }
+    if (sscanf (line, "%31s %31s %lf", entries[count].workload,
+                entries[count].metric, &entries[count].value) == 3) {
+      count++;
+    }
+  }
+  fclose (file);
+  return count;
+}
+
+/**
+ * @desc    Find baseline entry
+ *
+ * @param   const Entry *
+ * @param   int - count
+ * @param   const char * - workload
+ * @param   const char * - metric
+ *
+ * @return  const Entry * - NULL if not found
+ */
+static const Entry * BENCH_Find (const Entry *entries, int count, const char *workload, const char *metric)
+{
+  int i;
+  for (i = 0; i < count; i++) {
+    if (!strcmp (entries[i].workload, workload) && !strcmp (entries[i].metric, metric)) {
+      return &entries[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @desc    Report metric and compare it with baseline
+ *
+ * @param   FILE * - results
+ * @param   const char * - workload
+ * @param   const char * - metric
+ * @param   double - value
+ * @param   const Entry * - baseline
+ * @param   int - baseline entries
+ *
+ * @return  int - 1 if regressed
+ */
+static int BENCH_Report (FILE *results, const char *workload, const char *metric, double value, const Entry *entries, int count)
+{
+  const Entry *base = BENCH_Find (entries, count, workload, metric);
+  const Entry *tol = BENCH_Find (entries, count, "tolerance", metric);
+  double limit;
+
+  fprintf (results, "%s %s %.0f\n", workload, metric, value);
+  printf ("  %-14s %-14s %12.0f", workload, metric, value);
+  if (!base) {
+    printf ("\n");
+    return 0;
+  }
+  limit = base->value * (1.0 + (tol ? tol->value : BENCH_TOLERANCE) / 100.0);
+  printf ("  baseline %12.0f", base->value);
+  if (value > limit) {
+    printf ("  REGRESSION\n");
+    return 1;
+  }
+  printf ("%s\n", (value < base->value) ? "  improved" : "");
+  return 0;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   int
+ * @param   char **
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  static Entry entries[BENCH_ENTRIES];
+  Metrics metrics;
+  FILE *results;
+  int count = 0;
+  int regressions = 0;
+  size_t i;
+
+  if (argc < 2) {
+    fprintf (stderr, "usage: %s <results> [baseline]\n", argv[0]);
+    return 2;
+  }
+  if (argc > 2) {
+    count = BENCH_LoadBaseline (argv[2], entries);
+    if (count < 0) {
+      fprintf (stderr, "bench: cannot read baseline %s\n", argv[2]);
+      return 2;
+    }
+  }
+  results = fopen (argv[1], "w");
+  if (!results) {
+    fprintf (stderr, "bench: cannot write results %s\n", argv[1]);
+    return 2;
+  }
+  for (i = 0; i < sizeof(workloads) / sizeof(workloads[0]); i++) {
+    memset (&metrics, 0, sizeof(metrics));
+    BENCH_Run (&workloads[i], &metrics);
+    regressions += BENCH_Report (results, workloads[i].name, "flushes", metrics.flushes, entries, count);
+    regressions += BENCH_Report (results, workloads[i].name, "fb_writes", metrics.fbWrites, entries, count);
+    regressions += BENCH_Report (results, workloads[i].name, "cmd_bytes", metrics.commands, entries, count);
+    regressions += BENCH_Report (results, workloads[i].name, "data_bytes", metrics.data, entries, count);
+    regressions += BENCH_Report (results, workloads[i].name, "ns_per_flush", metrics.ns / metrics.flushes, entries, count);
+    // bus throughput needed to keep timer pace
+    if (workloads[i].hz) {
+      regressions += BENCH_Report (results, workloads[i].name, "bus_bytes_per_s",
+                                   (double) (metrics.commands + metrics.data) * workloads[i].hz / metrics.flushes,
+                                   entries, count);
+    }
+    // flash size of compressed images
+    if (benchImageBytes) {
+      regressions += BENCH_Report (results, workloads[i].name, "image_bytes", benchImageBytes, entries, count);
+    }
+    // flash size of fonts
+    if (benchFontBytes) {
+      regressions += BENCH_Report (results, workloads[i].name, "font_bytes", benchFontBytes, entries, count);
+    }
+    // wall time per glyph
+    if (benchGlyphs) {
+      regressions += BENCH_Report (results, workloads[i].name, "ns_per_glyph", metrics.ns / benchGlyphs, entries, count);
+    }
+    // wall time per fill
+    if (benchFills) {
+      regressions += BENCH_Report (results, workloads[i].name, "ns_per_fill", metrics.ns / benchFills, entries, count);
+    }
+  }
+  fclose (results);
+  if (regressions) {
+    printf ("bench: %d metric(s) regressed\n", regressions);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,25 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @desc        Host shim of <avr/interrupt.h>
+ *              ISR is plain function called by emulator
+ * ---------------------------------------------------------------+ 
+ * @datum       18.10.2026
+ * @file        interrupt.h
+ * @tested      Linux gcc
+ *
+ * @depend      
+ * ---------------------------------------------------------------+
+ */
+#include <avr/io.h>
+
+#ifndef __HOST_AVR_INTERRUPT_H__
+#define __HOST_AVR_INTERRUPT_H__
+
+  #define ISR(vector)       void vector (void)
+  #define sei()
+  #define cli()
+
+  // interrupt vectors
+  void SPI_STC_vect (void);
+
+#endif
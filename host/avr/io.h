@@ -0,0 +1,53 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @desc        Host shim of <avr/io.h> - registers used by driver
+ * ---------------------------------------------------------------+ 
+ * @datum       18.10.2026
+ * @file        io.h
+ * @tested      Linux gcc
+ *
+ * @depend      
+ * ---------------------------------------------------------------+
+ */
+#include <stdint.h>
+
+#ifndef __HOST_AVR_IO_H__
+#define __HOST_AVR_IO_H__
+
+  // registers, defined in emulator.c
+  // -----------------------------------
+  extern volatile uint8_t PORTB;
+  extern volatile uint8_t DDRB;
+  extern volatile uint8_t SPCR;
+  extern volatile uint8_t SPSR;
+  extern volatile uint8_t SPDR;
+
+  // PORTB pins
+  // -----------------------------------
+  #define PB0               0
+  #define PB1               1
+  #define PB2               2
+  #define PB3               3
+  #define PB4               4
+  #define PB5               5
+  #define PB6               6
+  #define PB7               7
+
+  // SPCR bits
+  // -----------------------------------
+  #define SPR0              0
+  #define SPR1              1
+  #define CPHA              2
+  #define CPOL              3
+  #define MSTR              4
+  #define DORD              5
+  #define SPE               6
+  #define SPIE              7
+
+  // SPSR bits
+  // -----------------------------------
+  #define SPI2X             0
+  #define WCOL              6
+  #define SPIF              7
+
+#endif
@@ -0,0 +1,27 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @desc        Host shim of <avr/pgmspace.h> - flash is plain memory
+ * ---------------------------------------------------------------+ 
+ * @datum       18.10.2026
+ * @file        pgmspace.h
+ * @tested      Linux gcc
+ *
+ * @depend      
+ * ---------------------------------------------------------------+
+ */
+#include <stdint.h>
+#include <string.h>
+
+#ifndef __HOST_AVR_PGMSPACE_H__
+#define __HOST_AVR_PGMSPACE_H__
+
+  #define PROGMEM
+  #define PSTR(s)               (s)
+  #define pgm_read_byte(addr)   (*(const uint8_t *) (addr))
+  #define pgm_read_word(addr)   (*(const uint16_t *) (addr))
+  #define pgm_read_dword(addr)  (*(const uint32_t *) (addr))
+  #define pgm_read_ptr(addr)    (*(const void * const *) (addr))
+  #define memcpy_P              memcpy
+  #define strlen_P              strlen
+
+#endif
@@ -0,0 +1,321 @@
+/** 
+ * --------------------------------------------------------------------------------------------+ 
+ * @desc        PCD8544 controller emulator (host build)
+ * --------------------------------------------------------------------------------------------+ 
+ * @datum       18.10.2026
+ * @file        emulator.c
+ * @tested      Linux gcc
+ *
+ * @depend      emulator.h, pcd8544.h
+ * --------------------------------------------------------------------------------------------+
+ * @usage       Instruction set according to datasheet PCD8544, table 1
+ */
+#include <stdio.h>
+#include <string.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "emulator.h"
+#include "../lib/pcd8544.h"
+
+// @var registers
+volatile uint8_t PORTB;
+volatile uint8_t DDRB;
+volatile uint8_t SPCR;
+volatile uint8_t SPSR = (1 << SPIF);
+volatile uint8_t SPDR;
+
+// @var Emulated controllers, default display attached to PORT, CE, DC
+PCD8544_Emu pcd8544EmuDevice[EMU_DEVICES] = {
+  { .function = 0x04, .port = &PORT, .ce = CE, .dc = DC },
+  { .function = 0x04 },
+  { .function = 0x04 },
+  { .function = 0x04 }
+};
+
+// @var Number of devices on bus (highest attached index + 1)
+static uint8_t emuDevices = 1;
+
+// @var Driver framebuffer byte writes
+uint32_t pcd8544FbWrites = 0;
+
+// @var SPI transfer complete interrupt pending
+static uint8_t spiPending = 0;
+
+/**
+ * @desc    Default SPI interrupt (driver built without asynchronous transfer)
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+__attribute__((weak)) void SPI_STC_vect (void)
+{
+}
+
+/**
+ * @desc    Reset emulated controllers (as RST impulse)
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void PCD8544_EmuReset (void)
+{
+  uint8_t i;
+  // clear state, counters and attachment
+  memset (pcd8544EmuDevice, 0x00, sizeof(pcd8544EmuDevice));
+  // after reset chip is in power down
+  for (i = 0; i < EMU_DEVICES; i++) {
+    pcd8544EmuDevice[i].function = 0x04;
+  }
+  // default display only
+  emuDevices = 1;
+  PCD8544_EmuAttach (0, &PORT, CE, DC);
+  // no pending interrupt
+  spiPending = 0;
+}
+
+/**
+ * @desc    Attach emulated controller to control pins
+ *
+ * @param   uint8_t - device 0 <= index < EMU_DEVICES
+ * @param   volatile uint8_t * - port
+ * @param   uint8_t - CE pin
+ * @param   uint8_t - DC pin
+ *
+ * @return  void
+ */
+void PCD8544_EmuAttach (uint8_t index, volatile uint8_t *port, uint8_t ce, uint8_t dc)
+{
+  pcd8544EmuDevice[index].port = port;
+  pcd8544EmuDevice[index].ce = ce;
+  pcd8544EmuDevice[index].dc = dc;
+  // extend bus scan
+  if (index >= emuDevices) {
+    emuDevices = index + 1;
+  }
+}
+
+/**
+ * @desc    Reset byte counters
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void PCD8544_EmuResetCounters (void)
+{
+  uint8_t i;
+  for (i = 0; i < EMU_DEVICES; i++) {
+    pcd8544EmuDevice[i].commands = 0;
+    pcd8544EmuDevice[i].data = 0;
+    pcd8544EmuDevice[i].errors = 0;
+  }
+}
+
+/**
+ * @desc    Execute command byte
+ *
+ * @param   PCD8544_Emu *
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+static void PCD8544_EmuCommand (PCD8544_Emu *emu, uint8_t cmd)
+{
+  // counter
+  emu->commands++;
+  // NOP
+  if (cmd == 0x00) {
+    return;
+  }
+  // function set 0 0 1 0 0 PD V H - both instruction sets
+  if ((cmd & 0xF8) == 0x20) {
+    emu->function = cmd & 0x07;
+    return;
+  }
+  // extended instruction set (H = 1)
+  if (emu->function & 0x01) {
+    // set Vop 1 Vop6 .. Vop0
+    if (cmd & 0x80) {
+      emu->vop = cmd & 0x7F;
+    // bias system 0 0 0 1 0 BS2 BS1 BS0
+    } else if ((cmd & 0xF8) == 0x10) {
+      emu->bias = cmd & 0x07;
+    // temperature control 0 0 0 0 0 1 TC1 TC0
+    } else if ((cmd & 0xFC) == 0x04) {
+      emu->temp = cmd & 0x03;
+    // reserved
+    } else {
+      emu->errors++;
+    }
+    return;
+  }
+  // basic instruction set (H = 0)
+  // set X address 1 X6 .. X0, 0 <= X <= 83
+  if (cmd & 0x80) {
+    if ((cmd & 0x7F) < EMU_COLS) {
+      emu->x = cmd & 0x7F;
+    } else {
+      emu->errors++;
+    }
+  // set Y address 0 1 0 0 0 Y2 Y1 Y0, 0 <= Y <= 5
+  } else if ((cmd & 0xF8) == 0x40) {
+    if ((cmd & 0x07) < EMU_ROWS) {
+      emu->y = cmd & 0x07;
+    } else {
+      emu->errors++;
+    }
+  // display control 0 0 0 0 1 D 0 E
+  } else if ((cmd & 0xFA) == 0x08) {
+    emu->display = cmd & 0x05;
+  // reserved
+  } else {
+    emu->errors++;
+  }
+}
+
+/**
+ * @desc    Write data byte and increment address pointer
+ *
+ * @param   PCD8544_Emu *
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+static void PCD8544_EmuData (PCD8544_Emu *emu, uint8_t data)
+{
+  // counter
+  emu->data++;
+  // write DDRAM
+  emu->ddram[emu->y][emu->x] = data;
+  // vertical addressing (V = 1)
+  if (emu->function & 0x02) {
+    if (++emu->y >= EMU_ROWS) {
+      emu->y = 0;
+      if (++emu->x >= EMU_COLS) {
+        emu->x = 0;
+      }
+    }
+  // horizontal addressing (V = 0)
+  } else {
+    if (++emu->x >= EMU_COLS) {
+      emu->x = 0;
+      if (++emu->y >= EMU_ROWS) {
+        emu->y = 0;
+      }
+    }
+  }
+}
+
+/**
+ * @desc    Clock one byte into controllers with CE low - SPI transport shim
+ *
+ * @param   uint8_t data
+ *
+ * @return  void
+ */
+void PCD8544_EmuClock (uint8_t data)
+{
+  PCD8544_Emu *emu;
+  uint8_t i;
+  // register written
+  SPDR = data;
+  // transfer complete interrupt raised after each byte
+  spiPending = 1;
+  // all controllers on bus
+  for (i = 0; i < emuDevices; i++) {
+    emu = &pcd8544EmuDevice[i];
+    // not attached or chip not enabled (CE active low)
+    if (!emu->port || (*emu->port & (1 << emu->ce))) {
+      continue;
+    }
+    // DC sampled with last bit - data high / command low
+    if (*emu->port & (1 << emu->dc)) {
+      PCD8544_EmuData (emu, data);
+    } else {
+      PCD8544_EmuCommand (emu, data);
+    }
+  }
+}
+
+/**
+ * @desc    Run pending SPI transfer complete interrupts
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void PCD8544_EmuService (void)
+{
+  // while interrupt enabled and pending
+  while (spiPending && (SPCR & (1 << SPIE))) {
+    spiPending = 0;
+    SPI_STC_vect ();
+  }
+}
+
+/**
+ * @desc    Pixel as visible on glass (display control applied)
+ *
+ * @param   uint8_t x - column 0 <= x <= 83
+ * @param   uint8_t y - row 0 <= y <= 47
+ *
+ * @return  uint8_t - 1 dark, 0 light
+ */
+uint8_t PCD8544_EmuPixel (uint8_t x, uint8_t y)
+{
+  uint8_t pixel = (pcd8544Emu.ddram[y >> 3][x] >> (y & 0x07)) & 0x01;
+  // power down - display off
+  if (pcd8544Emu.function & 0x04) {
+    return 0;
+  }
+  // display control D, E
+  switch (pcd8544Emu.display) {
+    // normal mode
+    case 0x04:
+      return pixel;
+    // inverse video mode
+    case 0x05:
+      return pixel ^ 0x01;
+    // all display segments on
+    case 0x01:
+      return 1;
+    // display blank
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @desc    Dump visible frame as binary PBM (P4)
+ *
+ * @param   const char * - file path
+ *
+ * @return  int - 0 success
+ */
+int PCD8544_EmuDumpPbm (const char *path)
+{
+  uint8_t x, y;
+  uint8_t byte;
+  FILE *file = fopen (path, "wb");
+  // open failed
+  if (!file) {
+    return -1;
+  }
+  // header
+  fprintf (file, "P4\n%d %d\n", EMU_COLS, EMU_ROWS * 8);
+  // rows packed MSB first, padded to byte
+  for (y = 0; y < EMU_ROWS * 8; y++) {
+    byte = 0;
+    for (x = 0; x < EMU_COLS; x++) {
+      byte |= PCD8544_EmuPixel (x, y) << (7 - (x & 0x07));
+      if (((x & 0x07) == 0x07) || (x == (EMU_COLS - 1))) {
+        fputc (byte, file);
+        byte = 0;
+      }
+    }
+  }
+  // close
+  return fclose (file);
+}
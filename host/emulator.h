@@ -0,0 +1,134 @@
+/** 
+ * --------------------------------------------------------------------------------------------+ 
+ * @desc        PCD8544 controller emulator (host build)
+ * --------------------------------------------------------------------------------------------+ 
+ * @datum       18.10.2026
+ * @file        emulator.h
+ * @tested      Linux gcc
+ *
+ * @depend      
+ * --------------------------------------------------------------------------------------------+
+ * @usage       Build library with -DPCD8544_HOST -Ihost, every SPI byte is clocked into
+ *              emulated controllers with CE / DC sampled from their ports (device 0 on
+ *              PORT, CE, DC, others attached by PCD8544_EmuAttach).
+ *              Decodes function set (PD, V, H), display control, X / Y address, extended
+ *              commands and auto-increment of address pointer in both addressing modes.
+ */
+
+#ifndef __EMULATOR_H__
+#define __EMULATOR_H__
+
+  #include <stdint.h>
+
+  // AREA definition
+  // -----------------------------------
+  #define EMU_ROWS          6
+  #define EMU_COLS          84
+  // emulated controllers on SPI bus
+  #define EMU_DEVICES       4
+
+  // Emulated controller state
+  // -----------------------------------
+  typedef struct {
+    // display data RAM, bank x column
+    uint8_t ddram[EMU_ROWS][EMU_COLS];
+    // address pointer
+    uint8_t x;
+    uint8_t y;
+    // function set - PD, V, H
+    uint8_t function;
+    // display control - D, E
+    uint8_t display;
+    // extended registers
+    uint8_t temp;
+    uint8_t bias;
+    uint8_t vop;
+    // transferred bytes
+    uint32_t commands;
+    uint32_t data;
+    // invalid / unknown commands
+    uint32_t errors;
+    // control port, CE / DC pin numbers (NULL port - not attached)
+    volatile uint8_t *port;
+    uint8_t ce;
+    uint8_t dc;
+  } PCD8544_Emu;
+
+  // @var Emulated controllers
+  extern PCD8544_Emu pcd8544EmuDevice[EMU_DEVICES];
+
+  // @var Emulated controller of default display
+  #define pcd8544Emu        (pcd8544EmuDevice[0])
+
+  // @var Driver framebuffer byte writes (counted by driver in host build)
+  extern uint32_t pcd8544FbWrites;
+
+  /**
+   * @desc    Reset emulated controllers (as RST impulse)
+   *          device 0 attached to PORT, CE, DC, others detached
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void PCD8544_EmuReset (void);
+
+  /**
+   * @desc    Attach emulated controller to control pins
+   *
+   * @param   uint8_t - device 0 <= index < EMU_DEVICES
+   * @param   volatile uint8_t * - port
+   * @param   uint8_t - CE pin
+   * @param   uint8_t - DC pin
+   *
+   * @return  void
+   */
+  void PCD8544_EmuAttach (uint8_t, volatile uint8_t *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Reset byte counters of all controllers
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void PCD8544_EmuResetCounters (void);
+
+  /**
+   * @desc    Clock one byte into controllers with CE low - SPI transport shim
+   *
+   * @param   uint8_t data
+   *
+   * @return  void
+   */
+  void PCD8544_EmuClock (uint8_t);
+
+  /**
+   * @desc    Run pending SPI transfer complete interrupts
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void PCD8544_EmuService (void);
+
+  /**
+   * @desc    Pixel as visible on glass of device 0 (display control applied)
+   *
+   * @param   uint8_t x - column 0 <= x <= 83
+   * @param   uint8_t y - row 0 <= y <= 47
+   *
+   * @return  uint8_t - 1 dark, 0 light
+   */
+  uint8_t PCD8544_EmuPixel (uint8_t, uint8_t);
+
+  /**
+   * @desc    Dump visible frame of device 0 as binary PBM (P4)
+   *
+   * @param   const char * - file path
+   *
+   * @return  int - 0 success
+   */
+  int PCD8544_EmuDumpPbm (const char *);
+
+#endif
@@ -0,0 +1,21 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @desc        Host shim of <util/atomic.h>
+ *              emulator runs ISRs only from service loop, block
+ *              executes once with nothing to mask
+ * ---------------------------------------------------------------+ 
+ * @datum       18.10.2026
+ * @file        atomic.h
+ * @tested      Linux gcc
+ *
+ * @depend      
+ * ---------------------------------------------------------------+
+ */
+#ifndef __HOST_UTIL_ATOMIC_H__
+#define __HOST_UTIL_ATOMIC_H__
+
+  #define ATOMIC_RESTORESTATE
+  #define ATOMIC_FORCEON
+  #define ATOMIC_BLOCK(type)  for (int __todo = 1; __todo; __todo = 0)
+
+#endif
@@ -0,0 +1,18 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @desc        Host shim of <util/delay.h> - no delay
+ * ---------------------------------------------------------------+ 
+ * @datum       18.10.2026
+ * @file        delay.h
+ * @tested      Linux gcc
+ *
+ * @depend      
+ * ---------------------------------------------------------------+
+ */
+#ifndef __HOST_UTIL_DELAY_H__
+#define __HOST_UTIL_DELAY_H__
+
+  #define _delay_ms(ms)
+  #define _delay_us(us)
+
+#endif
@@ -25,4 +25,29 @@
   // @const Characters
   extern const uint8_t FONTS[][CHARS_COLS_LENGTH];
 
+  // Font descriptor (PROGMEM) - generated by tools/bdf2pcd
+  // -----------------------------------
+  typedef struct {
+    // glyph columns, ceil(height / 8) banks of width bytes per glyph
+    const uint8_t *bitmap;
+    // glyph start in bitmap, count + extra entries
+    const uint16_t *offset;
+    // glyph width, count + extra entries, 0 if not stored
+    const uint8_t *width;
+    // code points >= 0x80 sorted ascending, glyph count + i, extra entries
+    const uint16_t *map;
+    // first character of directly indexed range (ASCII)
+    uint8_t first;
+    // number of directly indexed characters from first
+    uint8_t count;
+    // number of mapped code points
+    uint8_t extra;
+    // glyph of unmapped code points >= 0x80 (ASCII), 0 none
+    uint8_t fallback;
+    // height in pixels
+    uint8_t height;
+    // columns between glyphs
+    uint8_t spacing;
+  } pcd8544_font_t;
+
 #endif
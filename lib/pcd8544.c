@@ -18,381 +18,5728 @@
  *              Ccommunication thorught 5 control wires (SCK, RST, DIN, CE, CS)
  */
 #include <avr/pgmspace.h>
+#include <avr/interrupt.h>
 #include <util/delay.h>
+#include <util/atomic.h>
 #include <string.h>
 #include "font.h"
 #include "pcd8544.h"
 
-// @var array Chache memory Lcd 6 * 84 = 504 bytes
-static char cacheMemLcd[CACHE_SIZE_MEM];
+#ifdef PCD8544_BANDED
 
-// @var array Chache memory char index
-int cacheMemIndex = 0;
+// @var array Strip memory - one bank 84 bytes, rasterized on update
+//      shared by all displays
+static uint8_t cacheMemLcd[MAX_NUM_COLS];
 
-/**
- * @desc    Initialise pcd8544 controller
- *
- * @param   void
- *
- * @return  void
- */
-void PCD8544_Init (void)
-{
-  // Actiavte pull-up register -> logical high on pin RST
-  PORT |= (1 << RST);
-  // Output: RST, SCK, DIN, CE, DC 
-  DDR  |= (1 << RST) | 
-          (1 << SCK) | 
-          (1 << DIN) | 
-          (1 << CE)  | 
-          (1 << DC);
-  // 1 ms delay and reset impulse
-  PCD8544_ResetImpulse();
-  // SPE  - SPI Enale
-  // MSTR - Master device
-  // SPR0 - Prescaler fclk/16 = 1MHz
-  SPCR |= (1 << SPE)  | 
-          (1 << MSTR) |
-          (1 << SPR0);
+// @var Bank held in strip memory
+static uint8_t rasterBank;
+
+// @var array Display list of default display
+static uint8_t displayList[PCD8544_DLIST_SIZE];
+
+// Raster window - only bank held in strip
+#define RASTER_FIRST        rasterBank
+#define RASTER_LAST         rasterBank
+#define RASTER_HAS(bank)    ((bank) == rasterBank)
+#define RASTER_PTR(bank)    (cacheMemLcd)
+
+static void PCD8544_ListReplay (pcd8544_t *);
+
+#else
+
+// @var array Chache memory Lcd 6 * 84 = 504 bytes of default display
+static uint8_t cacheMemLcd[CACHE_SIZE_MEM];
+
+// Raster window - whole framebuffer of display
+#define RASTER_FIRST        0
+#define RASTER_LAST         (MAX_NUM_ROWS - 1)
+#define RASTER_HAS(bank)    ((bank) <= RASTER_LAST)
+#define RASTER_PTR(bank)    (&lcd->cache[(bank) * MAX_NUM_COLS])
+
+#endif
+
+#ifdef PCD8544_MULTI
+// Control pins of display - masks through port pointer of context
+#define CE_ENABLE(lcd)      PCD8544_PortClr ((lcd), (lcd)->ce)
+#define CE_DISABLE(lcd)     PCD8544_PortSet ((lcd), (lcd)->ce)
+#define DC_COMMAND(lcd)     PCD8544_PortClr ((lcd), (lcd)->dc)
+#define DC_DATA(lcd)        PCD8544_PortSet ((lcd), (lcd)->dc)
+#else
+// Control pins of display - compile-time PORT, CE, DC (single SBI / CBI)
+#define CE_ENABLE(lcd)      CLR_BIT (PORT, CE)
+#define CE_DISABLE(lcd)     SET_BIT (PORT, CE)
+#define DC_COMMAND(lcd)     CLR_BIT (PORT, DC)
+#define DC_DATA(lcd)        SET_BIT (PORT, DC)
+#endif
+
+// @const array Init sequence
+static const uint8_t initSequence[] PROGMEM = {
   // extended instruction set
-  PCD8544_CommandSend (FUNCTION_SET | EXTEN_INS_SET);
+  FUNCTION_SET | EXTEN_INS_SET,
   // temperature set - temperature coefficient of IC / correction 3
-  PCD8544_CommandSend (TEMP_CONTROL | TEMP_COEF_3);
+  TEMP_CONTROL | TEMP_COEF_3,
   // bias 1:48 - optimum bias value
-  PCD8544_CommandSend (BIAS_CONTROL | BIAS_1_48);
+  BIAS_CONTROL | BIAS_1_48,
   // for mux 1:48 optimum operation voltage is Ulcd = 6,06.Uth
   // Ulcd = 3,06 + (Ucp6 to Ucp0) x 0,06
   // 6 < Ulcd < 8,05
   // command for operation voltage = 0x1 Ucp6 Ucp5 Ucp4 Ucp3 Ucp2 Ucp1 Ucp0
   // Ulcd = 0x11000010 = 7,02 V
-  PCD8544_CommandSend (0xC2);
+  0xC2,
   // normal instruction set / horizontal adressing mode
-  PCD8544_CommandSend (FUNCTION_SET | BASIC_INS_SET | HORIZ_ADDR_MODE);
+  FUNCTION_SET | BASIC_INS_SET | HORIZ_ADDR_MODE,
   // normal mode
-  PCD8544_CommandSend (DISPLAY_CONTROL | NORMAL_MODE);
-}
+  DISPLAY_CONTROL | NORMAL_MODE
+};
+
+// @var Default display
+#ifdef PCD8544_BANDED
+pcd8544_t pcd8544Default = PCD8544_CTX (displayList, &PORT, &DDR, CE, DC, RST);
+#else
+pcd8544_t pcd8544Default = PCD8544_CTX (cacheMemLcd, &PORT, &DDR, CE, DC, RST);
+#endif
 
 /**
- * @desc    Command send
+ * @desc    Set pins of display port - read-modify-write through pointer
+ *          is not atomic, SPI_STC_vect and user code may share port
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t mask
  *
- * @param   char
- * 
  * @return  void
  */
-void PCD8544_CommandSend (char data)
+static inline void PCD8544_PortSet (pcd8544_t *lcd, uint8_t mask)
 {
-  // chip enable - active low
-  // PORT &= ~(1 << CE);
-  CLR_BIT (PORT, CE);
-  // command (active low)
-  // PORT &= ~(1 << DC);
-  CLR_BIT (PORT, DC);
-  // transmitting data
-  SPDR = data;
-  // wait till data transmit
-  // while (!(SPSR & (1 << SPIF)));
-  WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
-  // chip disable - idle high
-  // PORT |= (1 << CE);
-  SET_BIT (PORT, CE);
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    *lcd->port |= mask;
+  }
 }
 
 /**
- * @desc    Data send
+ * @desc    Clear pins of display port - read-modify-write through pointer
+ *          is not atomic, SPI_STC_vect and user code may share port
  *
- * @param   char 
+ * @param   pcd8544_t *
+ * @param   uint8_t mask
  *
  * @return  void
  */
-void PCD8544_DataSend (char data)
+static inline void PCD8544_PortClr (pcd8544_t *lcd, uint8_t mask)
 {
-  // chip enable - active low
-  // PORT &= ~(1 << CE);
-  CLR_BIT (PORT, CE);
-  // data (active high)
-  // PORT |= 1 << DC;
-  SET_BIT (PORT, DC);
-  // transmitting data
-  SPDR = data;
-  // wait till data transmit
-  // while (!(SPSR & (1 << SPIF)));
-  WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF);
-  // chip disable - idle high
-  // PORT |= (1 << CE);
-  SET_BIT (PORT, CE);
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    *lcd->port &= ~mask;
+  }
 }
 
+// @var Asynchronous transfer in progress
+static volatile uint8_t asyncBusy = 0;
+
 /**
- * @desc    Reset impulse
+ * @desc    Claim SPI bus for synchronous transfer - waits for asynchronous
+ *          transfer; grayscale tick finds bus busy and drops its frame
  *
  * @param   void
  *
  * @return  void
  */
-void PCD8544_ResetImpulse (void)
+static inline void PCD8544_BusClaim (void)
 {
-  // delay 1ms
-  _delay_ms(1);
-  // Reset Low 
-  // PORT &= ~(1 << RST);
-  CLR_BIT (PORT, RST);
-  // delay 1ms
-  _delay_ms(1);
-  // Reset High
-  // PORT |=  (1 << RST);
-  SET_BIT (PORT, RST);
+#ifdef PCD8544_ASYNC
+  uint8_t claimed = 0;
+  // test and set against interrupts starting transfer
+  while (!claimed) {
+    ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+      if (!asyncBusy) {
+        asyncBusy = 1;
+        claimed = 1;
+      }
+    }
+  }
+#endif
 }
 
 /**
- * @desc    Clear screen
+ * @desc    Release SPI bus after synchronous transfer
  *
  * @param   void
  *
  * @return  void
  */
-void PCD8544_ClearScreen (void)
+static inline void PCD8544_BusRelease (void)
 {
-  // null cache memory lcd
-  memset (cacheMemLcd, 0x00, CACHE_SIZE_MEM);
+#ifdef PCD8544_ASYNC
+  asyncBusy = 0;
+#endif
 }
 
+#ifdef PCD8544_ASYNC
+
+// @var Display of asynchronous transfer
+static pcd8544_t *asyncLcd;
+
+// @var Displays waiting for asynchronous transfer
+static pcd8544_t **asyncQueue;
+
+// @var Number of displays waiting for asynchronous transfer
+static uint8_t asyncQueueLen;
+
+// @var Display of single asynchronous update (queue of one)
+static pcd8544_t *asyncSingle;
+
+// @var Asynchronous transfer frame (cache or gray plane)
+static const uint8_t *asyncFrame;
+
+// @var Asynchronous transfer next cache byte
+static const uint8_t *asyncPtr;
+
+// @var Asynchronous transfer state
+static uint8_t asyncState;
+
+// @var Asynchronous transfer bank
+static uint8_t asyncBank;
+
+// @var Asynchronous transfer column
+static uint8_t asyncCol;
+
+// @var Display of grayscale engine, NULL if stopped
+static pcd8544_t * volatile grayLcd = 0;
+
+// @var Gray planes of weight 2 (cache), 1
+static const uint8_t *grayPlane[2];
+
+// @var Frame of gray cycle
+static uint8_t grayPhase;
+
+#endif
+
+// @var Asynchronous transfer completion callback
+static void (*asyncCallback)(void) = 0;
+
+// @type RLE decoder state
+typedef struct {
+  // next byte of stream
+  const uint8_t *src;
+  // bytes left in packet
+  uint8_t count;
+  // packet is run
+  uint8_t run;
+  // byte of run
+  uint8_t value;
+} rle_t;
+
+// @type Glyph of text font
+typedef struct {
+  // columns (PROGMEM), banks of width bytes
+  const uint8_t *bitmap;
+  // size in pixels
+  uint8_t width;
+  uint8_t height;
+  // cursor advance - width + spacing
+  uint8_t advance;
+} glyph_t;
+
+// @struct Circle, ellipse or arc - recorded as is in banded mode
+typedef struct {
+  // center
+  int16_t x;
+  int16_t y;
+  // radii
+  uint8_t rx;
+  uint8_t ry;
+  // arc start and end directions x, y (y axis up), scaled 127
+  int8_t arc[4];
+  // arc longer than half circle
+  uint8_t wide;
+  // SHAPE_CIRCLE / _FILL_CIRCLE / _ELLIPSE / _FILL_ELLIPSE / _ARC
+  uint8_t kind;
+  // PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+  uint8_t op;
+} shape_t;
+
+// @struct Polygon chain from leftmost to rightmost vertex
+typedef struct {
+  // vertices, x y int16_t pairs
+  const uint8_t *points;
+  uint8_t count;
+  // 1 forward, count - 1 backward
+  uint8_t step;
+  // rightmost vertex
+  uint8_t last;
+  // current edge from vertex a to b
+  uint8_t a;
+  uint8_t b;
+  int16_t xa;
+  int16_t xb;
+  // row on current column and rows per column, 16.16
+  int32_t y;
+  int32_t slope;
+} edge_t;
+
+// @const array Bank masks from row (row & 7) to bottom of bank
+static const uint8_t maskFrom[8] PROGMEM = {
+  0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80
+};
+
+// @const array Bank masks from top of bank to row (row & 7)
+static const uint8_t maskTo[8] PROGMEM = {
+  0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF
+};
+
+// @const array Decimal weights of digits above units (subtracted, no division)
+static const uint32_t powers[9] PROGMEM = {
+  1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10
+};
+
+// @const array Sine of 0 - 90 degrees scaled 127
+static const uint8_t sine[91] PROGMEM = {
+    0,   2,   4,   7,   9,  11,  13,  15,  18,  20,  22,  24,  26,  29,  31,  33,
+   35,  37,  39,  41,  43,  46,  48,  50,  52,  54,  56,  58,  60,  62,  63,  65,
+   67,  69,  71,  73,  75,  76,  78,  80,  82,  83,  85,  87,  88,  90,  91,  93,
+   94,  96,  97,  99, 100, 101, 103, 104, 105, 107, 108, 109, 110, 111, 112, 113,
+  114, 115, 116, 117, 118, 119, 119, 120, 121, 121, 122, 123, 123, 124, 124, 125,
+  125, 125, 126, 126, 126, 127, 127, 127, 127, 127, 127
+};
+
 /**
- * @desc    Update screen
+ * @desc    Mark columns of bank as modified
  *
- * @param   void
+ * @param   pcd8544_t *
+ * @param   uint8_t bank - 0 <= bank <= 5
+ * @param   uint8_t from - first modified column
+ * @param   uint8_t to   - last modified column
  *
  * @return  void
  */
-void PCD8544_UpdateScreen (void)
+static inline void PCD8544_MarkDirty (pcd8544_t *lcd, uint8_t bank, uint8_t from, uint8_t to)
 {
-  int i;
-  // set position x, y
-  PCD8544_SetTextPosition(0, 0);
-  // loop through cache memory lcd
-  for (i=0; i<CACHE_SIZE_MEM; i++) {
-    // write data to lcd memory
-    PCD8544_DataSend(cacheMemLcd[i]);
-  }  
+#ifdef PCD8544_BANDED
+  // every update rasterizes whole frame
+  (void) lcd;
+  (void) bank;
+  (void) from;
+  (void) to;
+#else
+  // extend span to the left
+  if (from < lcd->dirtyFrom[bank]) {
+    lcd->dirtyFrom[bank] = from;
+  }
+  // extend span to the right
+  if (to > lcd->dirtyTo[bank]) {
+    lcd->dirtyTo[bank] = to;
+  }
+#endif
 }
 
 /**
- * @desc    Draw character
+ * @desc    Track controller state in commands sent to controller
  *
- * @param   char
+ * @param   pcd8544_t *
+ * @param   uint8_t command
  *
- * @return  char
+ * @return  void
  */
-char PCD8544_DrawChar (char character)
+static void PCD8544_ShadowCommand (pcd8544_t *lcd, uint8_t command)
 {
-  unsigned int i;
-  // check if character is out of range
-  if ((character < 0x20) &&
-      (character > 0x7f)) { 
-    // out of range
-    return 0;
+  // function set is valid in both instruction sets
+  if ((command & 0xF8) == FUNCTION_SET) {
+    lcd->function = command;
+  // extended instruction set - no shadowed state
+  } else if ((lcd->function & EXTEN_INS_SET) && (lcd->function != 0xFF)) {
+    return;
+  // set x-address (unknown if instruction set unknown)
+  } else if (command & 0x80) {
+    lcd->x = (lcd->function == 0xFF) ? 0xFF : (command & 0x7F);
+  // set y-address
+  } else if ((command & 0xF8) == 0x40) {
+    lcd->y = (lcd->function == 0xFF) ? 0xFF : (command & 0x07);
+  // display control
+  } else if ((command & 0xFA) == DISPLAY_CONTROL) {
+    lcd->display = (lcd->function == 0xFF) ? 0xFF : command;
+  }
+}
+
+/**
+ * @desc    Address commands needed to move controller pointer
+ *          to bank, column; shadow is updated
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t * buffer - at least 2 bytes
+ * @param   uint8_t bank
+ * @param   uint8_t col
+ *
+ * @return  uint8_t - number of commands in buffer
+ */
+static uint8_t PCD8544_Address (pcd8544_t *lcd, uint8_t *buffer, uint8_t bank, uint8_t col)
+{
+  uint8_t len = 0;
+  // set y-address (bank)
+  if (lcd->y != bank) {
+    lcd->y = bank;
+    buffer[len++] = 0x40 | bank;
+  }
+  // set x-address (column)
+  if (lcd->x != col) {
+    lcd->x = col;
+    buffer[len++] = 0x80 | col;
+  }
+  // commands
+  return len;
+}
+
+/**
+ * @desc    Pointer after bytes written in horizontal addressing
+ *
+ * @param   uint8_t * x
+ * @param   uint8_t * y
+ * @param   uint8_t bank - bank written
+ * @param   uint8_t last - last column written
+ *
+ * @return  void
+ */
+static inline void PCD8544_PointerAfterRow (uint8_t *x, uint8_t *y, uint8_t bank, uint8_t last)
+{
+  // next column
+  *x = last + 1;
+  *y = bank;
+  // wrap to next bank
+  if (*x == MAX_NUM_COLS) {
+    *x = 0;
+    if (++*y == MAX_NUM_ROWS) {
+      *y = 0;
+    }
+  }
+}
+
+/**
+ * @desc    Pointer after bytes written in vertical addressing
+ *
+ * @param   uint8_t * x
+ * @param   uint8_t * y
+ * @param   uint8_t col - column written
+ * @param   uint8_t last - last bank written
+ *
+ * @return  void
+ */
+static inline void PCD8544_PointerAfterColumn (uint8_t *x, uint8_t *y, uint8_t col, uint8_t last)
+{
+  // next bank
+  *x = col;
+  *y = last + 1;
+  // wrap to next column
+  if (*y == MAX_NUM_ROWS) {
+    *y = 0;
+    if (++*x == MAX_NUM_COLS) {
+      *x = 0;
+    }
+  }
+}
+
+/**
+ * @desc    Glyph of font by index
+ *
+ * @param   const pcd8544_font_t * font - PROGMEM, NULL built-in 5x7
+ * @param   uint8_t index - character - first, mapped glyphs from count
+ * @param   glyph_t *
+ *
+ * @return  char - error if glyph not stored
+ */
+static char PCD8544_GlyphAt (const pcd8544_font_t *font, uint8_t index, glyph_t *glyph)
+{
+  const uint8_t *width;
+  const uint16_t *offset;
+  // built-in font 0x20 - 0x7F
+  if (!font) {
+    glyph->bitmap = FONTS[index];
+    glyph->width = CHARS_COLS_LENGTH;
+    glyph->height = 8;
+    // glyph + 1 column space
+    glyph->advance = CHARS_COLS_LENGTH + 1;
+    // success return
+    return PCD8544_SUCCESS;
+  }
+  // tables from ROM memory
+  width = pgm_read_ptr (&font->width);
+  // glyph not stored
+  if ((glyph->width = pgm_read_byte (&width[index])) == 0) {
+    // error return
+    return PCD8544_ERROR;
   }
-  // 
-  if ((cacheMemIndex % MAX_NUM_COLS) > (MAX_NUM_COLS - 5)) {
-    // check if memory index not longer than 48 x 84
-    if ((((cacheMemIndex / MAX_NUM_COLS) + 1) * MAX_NUM_COLS) > CACHE_SIZE_MEM) {
+  offset = pgm_read_ptr (&font->offset);
+  glyph->bitmap = (const uint8_t *) pgm_read_ptr (&font->bitmap) + pgm_read_word (&offset[index]);
+  glyph->height = pgm_read_byte (&font->height);
+  glyph->advance = glyph->width + pgm_read_byte (&font->spacing);
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Glyph index of code point - ASCII by direct index of font
+ *          tables, code points >= 0x80 by binary search in sparse map,
+ *          unmapped ones replaced by fallback glyph of font
+ *
+ * @param   const pcd8544_font_t * font - PROGMEM, NULL built-in 5x7
+ * @param   uint16_t code
+ * @param   uint8_t * index
+ *
+ * @return  char - error if font has no glyph of code point
+ */
+static char PCD8544_GlyphIndex (const pcd8544_font_t *font, uint16_t code, uint8_t *index)
+{
+  uint8_t first, count, extra, fallback;
+  uint8_t low, high, mid;
+  const uint16_t *map;
+  // built-in font 0x20 - 0x7F
+  if (!font) {
+    // unmapped code point
+    if (code > 0x7F) {
+      code = '?';
+    }
+    // check if character is out of range
+    if (code < 0x20) {
       // out of range
-      return 0;
+      return PCD8544_ERROR;
     }
-    // resize index on new row
-    cacheMemIndex = ((cacheMemIndex / MAX_NUM_COLS) + 1) * MAX_NUM_COLS;
+    *index = code - 0x20;
+    // success return
+    return PCD8544_SUCCESS;
   }
-  // loop through 5 bytes
-  for (i = 0; i < 5; i++) {
-    // read from ROM memory 
-    cacheMemLcd[cacheMemIndex++] = pgm_read_byte(&FONTS[character - 32][i]);
+  // directly indexed range
+  first = pgm_read_byte (&font->first);
+  count = pgm_read_byte (&font->count);
+  if ((uint16_t) (code - first) < count) {
+    *index = code - first;
+    // success return
+    return PCD8544_SUCCESS;
   }
-  //
-  cacheMemIndex++;
-  // return exit
-  return 0;
+  // control characters and ASCII are not mapped
+  if (code < 0x80) {
+    // error return
+    return PCD8544_ERROR;
+  }
+  // binary search of sorted code points
+  map = pgm_read_ptr (&font->map);
+  extra = pgm_read_byte (&font->extra);
+  low = 0;
+  high = extra;
+  while (low < high) {
+    mid = (low + high) >> 1;
+    if (pgm_read_word (&map[mid]) < code) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  // mapped glyph follows directly indexed ones
+  if ((low < extra) && (pgm_read_word (&map[low]) == code)) {
+    *index = count + low;
+    // success return
+    return PCD8544_SUCCESS;
+  }
+  // fallback glyph (directly indexed)
+  fallback = pgm_read_byte (&font->fallback);
+  if ((uint8_t) (fallback - first) < count) {
+    *index = fallback - first;
+    // success return
+    return PCD8544_SUCCESS;
+  }
+  // no fallback
+  return PCD8544_ERROR;
 }
 
 /**
- * @desc    Draw string
+ * @desc    Decode next code point of UTF-8 string (up to 3 bytes - BMP),
+ *          invalid or truncated sequence and code points outside BMP
+ *          give PCD8544_UTF8_INVALID
  *
- * @param   char *
+ * @param   const char ** - string, moved after sequence
  *
- * @return  void
+ * @return  uint16_t
  */
-void PCD8544_DrawString (char *str)
+static uint16_t PCD8544_Utf8Next (const char **str)
 {
-  unsigned int i = 0;
-  // loop through 5 bytes
-  while (str[i] != '\0') {
-    // read characters and increment index
-    PCD8544_DrawChar(str[i++]);
+  const uint8_t *byte = (const uint8_t *) *str;
+  uint16_t code = *byte++;
+  uint8_t follow;
+  // 2 bytes sequence 110x xxxx
+  if ((code & 0xE0) == 0xC0) {
+    code &= 0x1F;
+    follow = 1;
+  // 3 bytes sequence 1110 xxxx
+  } else if ((code & 0xF0) == 0xE0) {
+    code &= 0x0F;
+    follow = 2;
+  // ASCII
+  } else if (code < 0x80) {
+    follow = 0;
+  // stray continuation byte or 4 bytes sequence
+  } else {
+    // skip continuation bytes
+    while ((*byte & 0xC0) == 0x80) {
+      byte++;
+    }
+    *str = (const char *) byte;
+    // one replacement for whole sequence
+    return PCD8544_UTF8_INVALID;
+  }
+  // continuation bytes 10xx xxxx
+  while (follow--) {
+    // truncated sequence, next byte decoded again
+    if ((*byte & 0xC0) != 0x80) {
+      code = PCD8544_UTF8_INVALID;
+      break;
+    }
+    code = (code << 6) | (*byte++ & 0x3F);
   }
+  *str = (const char *) byte;
+  // code point
+  return code;
 }
 
+#ifdef PCD8544_BANDED
+
+// Blit record size - type, bitmap, mask, x, y, w, h, op
+#define DLIST_BLIT_SIZE     (1 + 2 * sizeof(const uint8_t *) + 2 * sizeof(int16_t) + 3)
+
+// Text record header size - type, x, y, count, next x, font, glyph indexes follow
+#define DLIST_TEXT_SIZE     (5 + sizeof(const pcd8544_font_t *))
+
+// Chart record size - type, chart
+#define DLIST_CHART_SIZE    (1 + sizeof(const pcd8544_chart_t *))
+
+// Sprite layer record size - type, sprites, count
+#define DLIST_SPRITES_SIZE  (2 + sizeof(const pcd8544_sprite_t *))
+
+// Shape record size - type, shape
+#define DLIST_SHAPE_SIZE    (1 + sizeof(shape_t))
+
+// Polygon record header size - type, op, count, x y pairs follow
+#define DLIST_POLYGON_SIZE  3
+
 /**
- * @desc    Set text position
+ * @desc    Allocate record in display list
  *
- * @param   char x - position / 0 <= rows <= 5 
- * @param   char y - position / 0 <= cols <= 14
+ * @param   pcd8544_t *
+ * @param   uint8_t len - record length
+ *
+ * @return  uint8_t * - NULL if display list full
+ */
+static uint8_t * PCD8544_ListAlloc (pcd8544_t *lcd, uint8_t len)
+{
+  uint8_t *record;
+  // display list full
+  if ((lcd->listLen + len) > PCD8544_DLIST_SIZE) {
+    return 0;
+  }
+  // record at end of list
+  record = &lcd->list[lcd->listLen];
+  lcd->listLen += len;
+  // allocated record
+  return record;
+}
+
+/**
+ * @desc    Record pixel
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t row
+ * @param   uint8_t col
  *
  * @return  char
  */
-char PCD8544_SetTextPosition (char x, char y)
+static char PCD8544_ListPixel (pcd8544_t *lcd, uint8_t row, uint8_t col)
 {
-  // check if x, y is in range
-  if ((x >= MAX_NUM_ROWS) ||
-      (y >= (MAX_NUM_COLS / 6))) {
-    // out of range
+  uint8_t *record = PCD8544_ListAlloc (lcd, 3);
+  // display list full
+  if (!record) {
     return PCD8544_ERROR;
   }
-  // normal instruction set / horizontal adressing mode
-  PCD8544_CommandSend(0x20);
-  // set x-position
-  PCD8544_CommandSend((0x40 | x));
-  // set y-position
-  PCD8544_CommandSend((0x80 | (y * 6)));
-  // calculate index memory
-  cacheMemIndex = (y * 6) + (x * MAX_NUM_COLS);
+  // pixel record
+  record[0] = DLIST_PIXEL;
+  record[1] = row;
+  record[2] = col;
   // success return
   return PCD8544_SUCCESS;
 }
 
 /**
- * @desc    Set pixel position
+ * @desc    Record line
+ *
+ * @param   pcd8544_t *
+ * @param   char x1, x2, y1, y2 - as DrawLine
  *
- * @param   char x - position / 0 <= rows <= 47 
- * @param   char y - position / 0 <= cols <= 83
- * 
  * @return  char
  */
-char PCD8544_SetPixelPosition (char x, char y)
-{ 
-  // check if x, y is in range
-  if ((x >= (MAX_NUM_ROWS * 8)) ||
-      (y >=  MAX_NUM_COLS)) {
-    // out of range
+static char PCD8544_ListLine (pcd8544_t *lcd, char x1, char x2, char y1, char y2)
+{
+  uint8_t *record = PCD8544_ListAlloc (lcd, 5);
+  // display list full
+  if (!record) {
     return PCD8544_ERROR;
   }
-  // normal instruction set
-  // horizontal adressing mode
-  PCD8544_CommandSend(0x20);
-  // set x-position
-  PCD8544_CommandSend((0x40 | (x / 8)));
-  // set y-position
-  PCD8544_CommandSend((0x80 | y));
-  // calculate index memory
-  cacheMemIndex = y + ((x / 8) * MAX_NUM_COLS);
+  // line record
+  record[0] = DLIST_LINE;
+  record[1] = x1;
+  record[2] = x2;
+  record[3] = y1;
+  record[4] = y2;
   // success return
   return PCD8544_SUCCESS;
 }
 
 /**
- * @desc    Draw pixel on x, y position
+ * @desc    Record clipped area operation
  *
- * @param   char x - position / 0 <= rows <= 47 
- * @param   char y - position / 0 <= cols <= 83
+ * @param   pcd8544_t *
+ * @param   uint8_t x0, x1 - columns
+ * @param   uint8_t y0, y1 - rows
+ * @param   uint8_t op
  *
  * @return  char
  */
-char PCD8544_DrawPixel (char x, char y)
-{ 
-  // set pixel position
-  if (PCD8544_SUCCESS == PCD8544_SetPixelPosition (x, y)) {
-    // out of range 
+static char PCD8544_ListFill (pcd8544_t *lcd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, uint8_t op)
+{
+  uint8_t *record = PCD8544_ListAlloc (lcd, 6);
+  // display list full
+  if (!record) {
     return PCD8544_ERROR;
   }
-  // send 1 as data
-  cacheMemLcd[cacheMemIndex] |= 1 << (x % 8);
+  // fill record
+  record[0] = DLIST_FILL;
+  record[1] = x0;
+  record[2] = x1;
+  record[3] = y0;
+  record[4] = y1;
+  record[5] = op;
   // success return
   return PCD8544_SUCCESS;
 }
 
 /**
- * @desc    Draw line by Bresenham algoritm
- * @surce   https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
- *  
- * @param   char x - position / 0 <= cols <= 83 
- * @param   char x - position / 0 <= cols <= 83 
- * @param   char y - position / 0 <= rows <= 47 
- * @param   char y - position / 0 <= rows <= 47
+ * @desc    Record bitmap blit
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t * bitmap - PROGMEM
+ * @param   const uint8_t * mask - PROGMEM or NULL
+ * @param   int16_t x, y
+ * @param   uint8_t w, h
+ * @param   uint8_t op
  *
  * @return  char
  */
-char PCD8544_DrawLine (char x1, char x2, char y1, char y2)
+static char PCD8544_ListBlit (pcd8544_t *lcd, const uint8_t *bitmap, const uint8_t *mask, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t op)
 {
-  // determinant
-  int16_t D;
-  // deltas
-  int16_t delta_x, delta_y;
-  // steps
-  int16_t trace_x = 1, trace_y = 1;
-
-  // delta x
-  delta_x = x2 - x1;
-  // delta y
-  delta_y = y2 - y1;
-
-  // check if x2 > x1
-  if (delta_x < 0) {
-    // negate delta x
-    delta_x = -delta_x;
-    // negate step x
-    trace_x = -trace_x;
+  uint8_t *record;
+  // nothing visible
+  if (((x + w) <= 0) || (x >= MAX_NUM_COLS) ||
+      ((y + h) <= 0) || (y >= (MAX_NUM_ROWS * 8))) {
+    // out of range
+    return PCD8544_ERROR;
   }
-
-  // check if y2 > y1
-  if (delta_y < 0) {
-    // negate detla y
-    delta_y = -delta_y;
-    // negate step y
-    trace_y = -trace_y;
+  // allocate
+  record = PCD8544_ListAlloc (lcd, DLIST_BLIT_SIZE);
+  // display list full
+  if (!record) {
+    return PCD8544_ERROR;
   }
+  // blit record
+  *record++ = DLIST_BLIT;
+  memcpy (record, &bitmap, sizeof(bitmap));
+  record += sizeof(bitmap);
+  memcpy (record, &mask, sizeof(mask));
+  record += sizeof(mask);
+  memcpy (record, &x, sizeof(x));
+  record += sizeof(x);
+  memcpy (record, &y, sizeof(y));
+  record += sizeof(y);
+  *record++ = w;
+  *record++ = h;
+  *record = op;
+  // success return
+  return PCD8544_SUCCESS;
+}
 
-  // Bresenham condition for m < 1 (dy < dx)
-  if (delta_y < delta_x) {
-    // calculate determinant
-    D = 2*delta_y - delta_x;
-    // draw first pixel
-    PCD8544_DrawPixel(y1, x1);
-    // check if x1 equal x2
-    while (x1 != x2) {
-      // update x1
-      x1 += trace_x;
-      // check if determinant is positive
-      if (D >= 0) {
-        // update y1
-        y1 += trace_y;
-        // update determinant
-        D -= 2*delta_x;    
-      }
-      // update deteminant
-      D += 2*delta_y;
-      // draw next pixel
-      PCD8544_DrawPixel(y1, x1);
-    }
-  // for m > 1 (dy > dx)    
-  } else {
-    // calculate determinant
-    D = delta_y - 2*delta_x;
-    // draw first pixel
-    PCD8544_DrawPixel(y1, x1);
-    // check if y2 equal y1
-    while (y1 != y2) {
-      // update y1
-      y1 += trace_y;
-      // check if determinant is positive
-      if (D <= 0) {
-        // update y1
-        x1 += trace_x;
-        // update determinant
-        D += 2*delta_y;    
-      }
-      // update deteminant
-      D -= 2*delta_x;
-      // draw next pixel
-      PCD8544_DrawPixel(y1, x1);
+/**
+ * @desc    Record glyph on text cursor
+ *          consecutive glyphs of same font share one text record
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t index - glyph of font
+ * @param   uint8_t advance - cursor advance of glyph
+ *
+ * @return  char
+ */
+static char PCD8544_ListChar (pcd8544_t *lcd, uint8_t index, uint8_t advance)
+{
+  uint8_t *record;
+  // last text record
+  if (lcd->listText != 0xFFFF) {
+    record = &lcd->list[lcd->listText];
+    // record at end of list and character continues it
+    if (((lcd->listText + DLIST_TEXT_SIZE + record[3]) == lcd->listLen) &&
+        (lcd->listLen < PCD8544_DLIST_SIZE) &&
+        (record[3] < 0xFF) &&
+        (record[2] == lcd->cursorY) &&
+        (record[4] == lcd->cursorX) &&
+        !memcmp (&record[5], &lcd->font, sizeof(lcd->font))) {
+      // append glyph
+      lcd->list[lcd->listLen++] = index;
+      record[3]++;
+      record[4] += advance;
+      // success return
+      return PCD8544_SUCCESS;
     }
   }
+  // new text record
+  record = PCD8544_ListAlloc (lcd, DLIST_TEXT_SIZE + 1);
+  // display list full
+  if (!record) {
+    return PCD8544_ERROR;
+  }
+  // text record
+  lcd->listText = record - lcd->list;
+  record[0] = DLIST_TEXT;
+  record[1] = lcd->cursorX;
+  record[2] = lcd->cursorY;
+  record[3] = 1;
+  record[4] = lcd->cursorX + advance;
+  memcpy (&record[5], &lcd->font, sizeof(lcd->font));
+  record[DLIST_TEXT_SIZE] = index;
   // success return
   return PCD8544_SUCCESS;
 }
+
+/**
+ * @desc    Record strip chart - ring is read when bands are rasterized
+ *
+ * @param   pcd8544_t *
+ * @param   const pcd8544_chart_t *
+ *
+ * @return  char
+ */
+static char PCD8544_ListChart (pcd8544_t *lcd, const pcd8544_chart_t *chart)
+{
+  uint8_t *record = PCD8544_ListAlloc (lcd, DLIST_CHART_SIZE);
+  // display list full
+  if (!record) {
+    return PCD8544_ERROR;
+  }
+  // chart record
+  record[0] = DLIST_CHART;
+  memcpy (&record[1], &chart, sizeof(chart));
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Record sprite layer - sprites are read when bands are
+ *          rasterized, layer recorded already is not recorded again
+ *
+ * @param   pcd8544_t *
+ * @param   const pcd8544_sprite_t *
+ * @param   uint8_t count
+ *
+ * @return  char
+ */
+static char PCD8544_ListSprites (pcd8544_t *lcd, const pcd8544_sprite_t *sprites, uint8_t count)
+{
+  uint8_t *record;
+  // same layer in display list
+  if (lcd->listSprites != 0xFFFF) {
+    record = &lcd->list[lcd->listSprites];
+    if ((record[1] == count) &&
+        !memcmp (&record[2], &sprites, sizeof(sprites))) {
+      // success return
+      return PCD8544_SUCCESS;
+    }
+  }
+  record = PCD8544_ListAlloc (lcd, DLIST_SPRITES_SIZE);
+  // display list full
+  if (!record) {
+    return PCD8544_ERROR;
+  }
+  // sprite layer record
+  lcd->listSprites = record - lcd->list;
+  record[0] = DLIST_SPRITES;
+  record[1] = count;
+  memcpy (&record[2], &sprites, sizeof(sprites));
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Record circle, ellipse or arc
+ *
+ * @param   pcd8544_t *
+ * @param   const shape_t *
+ *
+ * @return  char
+ */
+static char PCD8544_ListShape (pcd8544_t *lcd, const shape_t *shape)
+{
+  uint8_t *record = PCD8544_ListAlloc (lcd, DLIST_SHAPE_SIZE);
+  // display list full
+  if (!record) {
+    return PCD8544_ERROR;
+  }
+  // shape record
+  record[0] = DLIST_SHAPE;
+  memcpy (&record[1], shape, sizeof(shape_t));
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Record polygon with copy of vertices
+ *
+ * @param   pcd8544_t *
+ * @param   const int16_t * points
+ * @param   uint8_t count
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+static char PCD8544_ListPolygon (pcd8544_t *lcd, const int16_t *points, uint8_t count, uint8_t op)
+{
+  uint8_t *record;
+  // more vertices than display list holds
+  if (count > ((PCD8544_DLIST_SIZE - DLIST_POLYGON_SIZE) / (2 * sizeof(int16_t)))) {
+    return PCD8544_ERROR;
+  }
+  record = PCD8544_ListAlloc (lcd, DLIST_POLYGON_SIZE + count * 2 * sizeof(int16_t));
+  // display list full
+  if (!record) {
+    return PCD8544_ERROR;
+  }
+  // polygon record
+  record[0] = DLIST_POLYGON;
+  record[1] = op;
+  record[2] = count;
+  memcpy (&record[DLIST_POLYGON_SIZE], points, count * 2 * sizeof(int16_t));
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+#endif
+
+/**
+ * @desc    Cache index of pixel
+ *
+ * @param   uint8_t row - 0 <= row <= 47
+ * @param   uint8_t col - 0 <= col <= 83
+ *
+ * @return  uint16_t
+ */
+static inline uint16_t PCD8544_PixelIndex (uint8_t row, uint8_t col)
+{
+  // bank * 84 + column
+  return (row >> 3) * MAX_NUM_COLS + col;
+}
+
+/**
+ * @desc    Bit mask of pixel in bank byte
+ *
+ * @param   uint8_t row - 0 <= row <= 47
+ *
+ * @return  uint8_t
+ */
+static inline uint8_t PCD8544_PixelMask (uint8_t row)
+{
+  // bit 0 is top row of bank
+  return 1 << (row & 0x07);
+}
+
+/**
+ * @desc    Initialise pcd8544 controller
+ *
+ * @param   pcd8544_t *
+ *
+ * @return  void
+ */
+void PCD8544_InitCtx (pcd8544_t *lcd)
+{
+  // Actiavte pull-up register -> logical high on pin RST
+  // chip disable - idle high, display ignores traffic of other displays
+  PCD8544_PortSet (lcd, lcd->rst | lcd->ce);
+  // Output: RST, CE, DC of display
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    *lcd->ddr |= lcd->rst | 
+                 lcd->ce  | 
+                 lcd->dc;
+  }
+  // 1 ms delay and reset impulse
+  PCD8544_ResetImpulseCtx (lcd);
+  // transport shared by all displays
+  // hardware SPI - SCK, DIN output, master, fclk / PCD8544_SPI_DIV
+  // bit-bang - SCK, DIN output, SCK idle low
+  SPI_INIT ();
+  // init sequence in one burst
+  PCD8544_CommandSendBufferCtx_P (lcd, initSequence, sizeof(initSequence));
+}
+
+/**
+ * @desc    Command send
+ *
+ * @param   pcd8544_t *
+ * @param   char
+ * 
+ * @return  void
+ */
+void PCD8544_CommandSendCtx (pcd8544_t *lcd, char data)
+{
+  // claim bus - waits for asynchronous transfer, grayscale tick drops frame
+  PCD8544_BusClaim ();
+  // chip enable - active low
+  // PORT &= ~(1 << CE);
+  CE_ENABLE (lcd);
+  // command (active low)
+  // PORT &= ~(1 << DC);
+  DC_COMMAND (lcd);
+  // controller state
+  PCD8544_ShadowCommand (lcd, data);
+  // transmitting data
+  SPI_WRITE (data);
+  // wait till data transmit
+  // while (!(SPSR & (1 << SPIF)));
+  SPI_WAIT ();
+  // chip disable - idle high
+  // PORT |= (1 << CE);
+  CE_DISABLE (lcd);
+  // release bus
+  PCD8544_BusRelease ();
+}
+
+/**
+ * @desc    Data send
+ *
+ * @param   pcd8544_t *
+ * @param   char 
+ *
+ * @return  void
+ */
+void PCD8544_DataSendCtx (pcd8544_t *lcd, char data)
+{
+  // claim bus - waits for asynchronous transfer, grayscale tick drops frame
+  PCD8544_BusClaim ();
+  // chip enable - active low
+  // PORT &= ~(1 << CE);
+  CE_ENABLE (lcd);
+  // data (active high)
+  // PORT |= 1 << DC;
+  DC_DATA (lcd);
+  // pointer moved outside of driver
+  lcd->x = lcd->y = 0xFF;
+  // transmitting data
+  SPI_WRITE (data);
+  // wait till data transmit
+  // while (!(SPSR & (1 << SPIF)));
+  SPI_WAIT ();
+  // chip disable - idle high
+  // PORT |= (1 << CE);
+  CE_DISABLE (lcd);
+  // release bus
+  PCD8544_BusRelease ();
+}
+
+/**
+ * @desc    Stream bytes from RAM, CE and DC already set
+ *          next byte is loaded while previous one is shifting out
+ *
+ * @param   const uint8_t *
+ * @param   uint16_t
+ *
+ * @return  void
+ */
+static void PCD8544_SpiStream (const uint8_t *data, uint16_t len)
+{
+  uint8_t byte;
+  // nothing to send
+  if (len == 0) {
+    return;
+  }
+  // transmitting first byte
+  SPI_WRITE (*data++);
+  // loop through rest of bytes
+  while (--len) {
+    // fetch next byte
+    byte = *data++;
+    // wait till previous byte transmit
+    SPI_WAIT ();
+    // transmitting data
+    SPI_WRITE (byte);
+  }
+  // wait till last byte transmit
+  SPI_WAIT ();
+}
+
+/**
+ * @desc    Stream bytes from flash, CE and DC already set
+ *          next byte is loaded while previous one is shifting out
+ *
+ * @param   const uint8_t * - PROGMEM
+ * @param   uint16_t
+ *
+ * @return  void
+ */
+static void PCD8544_SpiStream_P (const uint8_t *data, uint16_t len)
+{
+  uint8_t byte;
+  // nothing to send
+  if (len == 0) {
+    return;
+  }
+  // transmitting first byte
+  SPI_WRITE (pgm_read_byte(data++));
+  // loop through rest of bytes
+  while (--len) {
+    // fetch next byte
+    byte = pgm_read_byte(data++);
+    // wait till previous byte transmit
+    SPI_WAIT ();
+    // transmitting data
+    SPI_WRITE (byte);
+  }
+  // wait till last byte transmit
+  SPI_WAIT ();
+}
+
+#ifndef PCD8544_BANDED
+
+/**
+ * @desc    Stream column of cache bytes (one per bank), CE and DC already set
+ *          next byte is loaded while previous one is shifting out
+ *
+ * @param   const uint8_t * - first byte
+ * @param   uint8_t - number of banks
+ *
+ * @return  void
+ */
+static void PCD8544_SpiStreamColumn (const uint8_t *data, uint8_t len)
+{
+  uint8_t byte;
+  // transmitting first byte
+  SPI_WRITE (*data);
+  // loop through rest of bytes
+  while (--len) {
+    // fetch byte of next bank
+    data += MAX_NUM_COLS;
+    byte = *data;
+    // wait till previous byte transmit
+    SPI_WAIT ();
+    // transmitting data
+    SPI_WRITE (byte);
+  }
+  // wait till last byte transmit
+  SPI_WAIT ();
+}
+
+#endif
+
+/**
+ * @desc    Command buffer send - CE asserted once for whole buffer
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t *
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+void PCD8544_CommandSendBufferCtx (pcd8544_t *lcd, const uint8_t *data, uint8_t len)
+{
+  uint8_t i;
+  // claim bus - waits for asynchronous transfer, grayscale tick drops frame
+  PCD8544_BusClaim ();
+  // controller state
+  for (i = 0; i < len; i++) {
+    PCD8544_ShadowCommand (lcd, data[i]);
+  }
+  // chip enable - active low
+  CE_ENABLE (lcd);
+  // command (active low)
+  DC_COMMAND (lcd);
+  // transmitting data
+  PCD8544_SpiStream (data, len);
+  // chip disable - idle high
+  CE_DISABLE (lcd);
+  // release bus
+  PCD8544_BusRelease ();
+}
+
+/**
+ * @desc    Command buffer send from flash - CE asserted once for whole buffer
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t * - PROGMEM
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+void PCD8544_CommandSendBufferCtx_P (pcd8544_t *lcd, const uint8_t *data, uint8_t len)
+{
+  uint8_t i;
+  // claim bus - waits for asynchronous transfer, grayscale tick drops frame
+  PCD8544_BusClaim ();
+  // controller state
+  for (i = 0; i < len; i++) {
+    PCD8544_ShadowCommand (lcd, pgm_read_byte(&data[i]));
+  }
+  // chip enable - active low
+  CE_ENABLE (lcd);
+  // command (active low)
+  DC_COMMAND (lcd);
+  // transmitting data
+  PCD8544_SpiStream_P (data, len);
+  // chip disable - idle high
+  CE_DISABLE (lcd);
+  // release bus
+  PCD8544_BusRelease ();
+}
+
+/**
+ * @desc    Data buffer send - CE asserted once for whole buffer
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t *
+ * @param   uint16_t
+ *
+ * @return  void
+ */
+void PCD8544_DataSendBufferCtx (pcd8544_t *lcd, const uint8_t *data, uint16_t len)
+{
+  // claim bus - waits for asynchronous transfer, grayscale tick drops frame
+  PCD8544_BusClaim ();
+  // chip enable - active low
+  CE_ENABLE (lcd);
+  // data (active high)
+  DC_DATA (lcd);
+  // pointer moved outside of driver
+  lcd->x = lcd->y = 0xFF;
+  // transmitting data
+  PCD8544_SpiStream (data, len);
+  // chip disable - idle high
+  CE_DISABLE (lcd);
+  // release bus
+  PCD8544_BusRelease ();
+}
+
+/**
+ * @desc    Data buffer send from flash - CE asserted once for whole buffer
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t * - PROGMEM
+ * @param   uint16_t
+ *
+ * @return  void
+ */
+void PCD8544_DataSendBufferCtx_P (pcd8544_t *lcd, const uint8_t *data, uint16_t len)
+{
+  // claim bus - waits for asynchronous transfer, grayscale tick drops frame
+  PCD8544_BusClaim ();
+  // chip enable - active low
+  CE_ENABLE (lcd);
+  // data (active high)
+  DC_DATA (lcd);
+  // pointer moved outside of driver
+  lcd->x = lcd->y = 0xFF;
+  // transmitting data
+  PCD8544_SpiStream_P (data, len);
+  // chip disable - idle high
+  CE_DISABLE (lcd);
+  // release bus
+  PCD8544_BusRelease ();
+}
+
+/**
+ * @desc    Set display mode - command sent only if mode differs
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t - DISPLAY_BLANK / NORMAL_MODE / ALL_SEGMS_ON / INVERSE_MODE
+ *
+ * @return  void
+ */
+void PCD8544_SetDisplayModeCtx (pcd8544_t *lcd, uint8_t mode)
+{
+  uint8_t command[2];
+  uint8_t len = 0;
+  // already set
+  if (lcd->display == (DISPLAY_CONTROL | mode)) {
+    return;
+  }
+  // display control is part of basic instruction set
+  if (lcd->function == 0xFF) {
+    command[len++] = FUNCTION_SET | BASIC_INS_SET | HORIZ_ADDR_MODE;
+  } else if (lcd->function & EXTEN_INS_SET) {
+    command[len++] = lcd->function & ~EXTEN_INS_SET;
+  }
+  // display control
+  command[len++] = DISPLAY_CONTROL | mode;
+  // transmitting commands, shadow updated
+  PCD8544_CommandSendBufferCtx (lcd, command, len);
+}
+
+/**
+ * @desc    Reset impulse
+ *
+ * @param   pcd8544_t *
+ *
+ * @return  void
+ */
+void PCD8544_ResetImpulseCtx (pcd8544_t *lcd)
+{
+  // delay 1ms
+  _delay_ms(1);
+  // Reset Low 
+  // PORT &= ~(1 << RST);
+  PCD8544_PortClr (lcd, lcd->rst);
+  // delay 1ms
+  _delay_ms(1);
+  // Reset High
+  // PORT |=  (1 << RST);
+  PCD8544_PortSet (lcd, lcd->rst);
+  // state after reset - power down, horizontal addressing,
+  // basic instruction set, display blank, address 0, 0
+  lcd->function = FUNCTION_SET | MODE_P_DOWN;
+  lcd->display = DISPLAY_CONTROL | DISPLAY_BLANK;
+  lcd->x = 0;
+  lcd->y = 0;
+}
+
+/**
+ * @desc    Clear screen
+ *
+ * @param   pcd8544_t *
+ *
+ * @return  void
+ */
+void PCD8544_ClearScreenCtx (pcd8544_t *lcd)
+{
+#ifdef PCD8544_BANDED
+  // empty display list - bands are rasterized on cleared strip
+  lcd->listLen = 0;
+  lcd->listText = 0xFFFF;
+  lcd->listSprites = 0xFFFF;
+#else
+  uint8_t bank;
+  // null cache memory lcd
+  memset (lcd->cache, 0x00, CACHE_SIZE_MEM);
+  FB_WRITES (CACHE_SIZE_MEM);
+  // whole frame modified
+  for (bank = 0; bank < MAX_NUM_ROWS; bank++) {
+    // all columns of bank
+    PCD8544_MarkDirty (lcd, bank, 0, MAX_NUM_COLS - 1);
+  }
+#endif
+}
+
+#ifdef PCD8544_BANDED
+
+/**
+ * @desc    Update screen
+ *          display list is rasterized one bank at a time into strip
+ *          memory and streamed straight to controller
+ *
+ * @param   pcd8544_t *
+ *
+ * @return  void
+ */
+void PCD8544_UpdateScreenCtx (pcd8544_t *lcd)
+{
+  // address commands
+  uint8_t address[3];
+  uint8_t len = 0;
+
+  // chip enable - active low for whole update
+  CE_ENABLE (lcd);
+  // command (active low)
+  DC_COMMAND (lcd);
+  // normal instruction set / horizontal adressing mode, if not already set
+  if (lcd->function != (FUNCTION_SET | BASIC_INS_SET | HORIZ_ADDR_MODE)) {
+    lcd->function = FUNCTION_SET | BASIC_INS_SET | HORIZ_ADDR_MODE;
+    address[len++] = lcd->function;
+  }
+  // address 0, 0 if pointer is not there
+  len += PCD8544_Address (lcd, &address[len], 0, 0);
+  // transmitting commands
+  PCD8544_SpiStream (address, len);
+  // loop through banks
+  for (rasterBank = 0; rasterBank < MAX_NUM_ROWS; rasterBank++) {
+    // clear strip
+    memset (cacheMemLcd, 0x00, MAX_NUM_COLS);
+    FB_WRITES (MAX_NUM_COLS);
+    // rasterize records into strip
+    PCD8544_ListReplay (lcd);
+    // data (active high)
+    DC_DATA (lcd);
+    // bank in one burst, auto-increment continues on next bank
+    PCD8544_SpiStream (cacheMemLcd, MAX_NUM_COLS);
+  }
+  // whole frame written - pointer wrapped to 0, 0
+  lcd->x = 0;
+  lcd->y = 0;
+  // chip disable - idle high
+  CE_DISABLE (lcd);
+}
+
+#else
+
+/**
+ * @desc    Move dirty spans to send spans and mark cache clean
+ *          chooses cheapest of horizontally addressed spans, vertically
+ *          addressed columns of bounding box, or full frame
+ *
+ * @param   pcd8544_t *
+ *
+ * @return  uint8_t - 0 if nothing to send
+ */
+static uint8_t PCD8544_PrepareSpans (pcd8544_t *lcd)
+{
+  uint8_t bank;
+  uint8_t col;
+  // controller pointer during transfer
+  uint8_t x = lcd->x;
+  uint8_t y = lcd->y;
+  // bytes needed for horizontally addressed spans
+  uint16_t horizontal = 0;
+  // bytes needed for vertically addressed bounding box
+  uint16_t vertical = 0;
+  // bytes needed for full frame
+  uint16_t full = CACHE_SIZE_MEM + (lcd->y != 0) + (lcd->x != 0);
+  // bounding box of spans
+  uint8_t colFirst = MAX_NUM_COLS - 1;
+  uint8_t colLast = 0;
+  uint8_t bankFirst = MAX_NUM_ROWS;
+  uint8_t bankLast = 0;
+  uint8_t height;
+
+  // count bytes needed to send dirty spans
+  for (bank = 0; bank < MAX_NUM_ROWS; bank++) {
+    // take over dirty span
+    lcd->sendFrom[bank] = lcd->dirtyFrom[bank];
+    lcd->sendTo[bank] = lcd->dirtyTo[bank];
+    // mark clean
+    lcd->dirtyFrom[bank] = 0xFF;
+    lcd->dirtyTo[bank] = 0;
+    // bank clean?
+    if (lcd->sendFrom[bank] > lcd->sendTo[bank]) {
+      continue;
+    }
+    // y-address / x-address commands if pointer does not match
+    horizontal += (y != bank) + (x != lcd->sendFrom[bank]);
+    // data bytes
+    horizontal += lcd->sendTo[bank] - lcd->sendFrom[bank] + 1;
+    // pointer after span
+    PCD8544_PointerAfterRow (&x, &y, bank, lcd->sendTo[bank]);
+    // extend bounding box
+    if (bankFirst == MAX_NUM_ROWS) {
+      bankFirst = bank;
+    }
+    bankLast = bank;
+    if (lcd->sendFrom[bank] < colFirst) {
+      colFirst = lcd->sendFrom[bank];
+    }
+    if (lcd->sendTo[bank] > colLast) {
+      colLast = lcd->sendTo[bank];
+    }
+  }
+  // nothing modified
+  if (bankFirst == MAX_NUM_ROWS) {
+    return 0;
+  }
+  // banks of bounding box
+  height = bankLast - bankFirst + 1;
+  // count bytes needed to send bounding box column by column
+  x = lcd->x;
+  y = lcd->y;
+  for (col = colFirst; col <= colLast; col++) {
+    // y-address / x-address commands if pointer does not match
+    vertical += (y != bankFirst) + (x != col) + height;
+    // pointer after column, auto-increment wraps to next column
+    // only if column ends in last bank
+    PCD8544_PointerAfterColumn (&x, &y, col, bankLast);
+  }
+  // function set if addressing mode has to be changed
+  if (lcd->function != (FUNCTION_SET | BASIC_INS_SET | HORIZ_ADDR_MODE)) {
+    horizontal++;
+    full++;
+  }
+  if (lcd->function != (FUNCTION_SET | BASIC_INS_SET | VERTI_ADDR_MODE)) {
+    vertical++;
+  }
+  // vertically addressed columns cheapest (tall and narrow region)?
+  if ((vertical < horizontal) && (vertical < full)) {
+    // column order
+    lcd->sendMode = VERTI_ADDR_MODE;
+    lcd->sendBankFirst = bankFirst;
+    lcd->sendBankLast = bankLast;
+    // bounding box columns in every bank of region
+    for (bank = bankFirst; bank <= bankLast; bank++) {
+      lcd->sendFrom[bank] = colFirst;
+      lcd->sendTo[bank] = colLast;
+    }
+  } else {
+    // bank order
+    lcd->sendMode = HORIZ_ADDR_MODE;
+    // full frame is cheaper or equal
+    if (horizontal >= full) {
+      // widen spans to whole banks
+      for (bank = 0; bank < MAX_NUM_ROWS; bank++) {
+        // all columns of bank
+        lcd->sendFrom[bank] = 0;
+        lcd->sendTo[bank] = MAX_NUM_COLS - 1;
+      }
+    }
+  }
+  // something to send
+  return 1;
+}
+
+/**
+ * @desc    Send vertically addressed columns of region, CE already set
+ *
+ * @param   pcd8544_t *
+ *
+ * @return  void
+ */
+static void PCD8544_SendColumns (pcd8544_t *lcd)
+{
+  uint8_t col;
+  uint8_t len;
+  // address commands
+  uint8_t address[2];
+  // banks of region
+  uint8_t height = lcd->sendBankLast - lcd->sendBankFirst + 1;
+
+  // loop through columns
+  for (col = lcd->sendFrom[lcd->sendBankFirst]; col <= lcd->sendTo[lcd->sendBankFirst]; col++) {
+    // address controller only where auto-increment does not match
+    len = PCD8544_Address (lcd, address, lcd->sendBankFirst, col);
+    if (len) {
+      // command (active low)
+      DC_COMMAND (lcd);
+      // transmitting commands
+      PCD8544_SpiStream (address, len);
+    }
+    // data (active high)
+    DC_DATA (lcd);
+    // column in one burst
+    PCD8544_SpiStreamColumn (&lcd->cache[lcd->sendBankFirst * MAX_NUM_COLS + col], height);
+    // pointer after column
+    PCD8544_PointerAfterColumn (&lcd->x, &lcd->y, col, lcd->sendBankLast);
+  }
+}
+
+/**
+ * @desc    Update screen
+ *          sends only modified column spans of banks or full frame
+ *          if it is cheaper
+ *
+ * @param   pcd8544_t *
+ *
+ * @return  void
+ */
+void PCD8544_UpdateScreenCtx (pcd8544_t *lcd)
+{
+  uint8_t bank;
+  uint8_t len;
+
+  // claim bus - waits for asynchronous transfer, grayscale tick drops frame
+  PCD8544_BusClaim ();
+  // nothing modified
+  if (!PCD8544_PrepareSpans (lcd)) {
+    // release bus
+    PCD8544_BusRelease ();
+    return;
+  }
+  // address commands
+  uint8_t address[2];
+
+  // chip enable - active low for whole update
+  CE_ENABLE (lcd);
+  // command (active low)
+  DC_COMMAND (lcd);
+  // normal instruction set / addressing mode, if not already set
+  if (lcd->function != (FUNCTION_SET | BASIC_INS_SET | lcd->sendMode)) {
+    lcd->function = FUNCTION_SET | BASIC_INS_SET | lcd->sendMode;
+    address[0] = lcd->function;
+    PCD8544_SpiStream (address, 1);
+  }
+  // tall and narrow region
+  if (lcd->sendMode == VERTI_ADDR_MODE) {
+    // send columns
+    PCD8544_SendColumns (lcd);
+    // chip disable - idle high
+    CE_DISABLE (lcd);
+    // release bus
+    PCD8544_BusRelease ();
+    // done
+    return;
+  }
+  // send spans
+  for (bank = 0; bank < MAX_NUM_ROWS; bank++) {
+    // bank clean?
+    if (lcd->sendFrom[bank] > lcd->sendTo[bank]) {
+      continue;
+    }
+    // address controller only where auto-increment does not match
+    len = PCD8544_Address (lcd, address, bank, lcd->sendFrom[bank]);
+    if (len) {
+      // command (active low)
+      DC_COMMAND (lcd);
+      // transmitting commands
+      PCD8544_SpiStream (address, len);
+    }
+    // data (active high)
+    DC_DATA (lcd);
+    // span in one burst
+    PCD8544_SpiStream (&lcd->cache[bank * MAX_NUM_COLS + lcd->sendFrom[bank]],
+                       lcd->sendTo[bank] - lcd->sendFrom[bank] + 1);
+    // pointer after span
+    PCD8544_PointerAfterRow (&lcd->x, &lcd->y, bank, lcd->sendTo[bank]);
+  }
+  // chip disable - idle high
+  CE_DISABLE (lcd);
+  // release bus
+  PCD8544_BusRelease ();
+}
+
+#ifdef PCD8544_ASYNC
+
+/**
+ * @desc    Find next bank with span to send
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t bank - first bank to search
+ *
+ * @return  uint8_t - bank or MAX_NUM_ROWS if none
+ */
+static uint8_t PCD8544_AsyncFindBank (pcd8544_t *lcd, uint8_t bank)
+{
+  // skip clean banks
+  while ((bank < MAX_NUM_ROWS) && (lcd->sendFrom[bank] > lcd->sendTo[bank])) {
+    bank++;
+  }
+  // found bank
+  return bank;
+}
+
+static void PCD8544_AsyncNext (void);
+
+/**
+ * @desc    First state of span / column - address commands only
+ *          where controller pointer does not match
+ *
+ * @param   pcd8544_t * - display of transfer
+ *
+ * @return  uint8_t - state
+ */
+static uint8_t PCD8544_AsyncAddressState (pcd8544_t *lcd)
+{
+  // next frame byte
+  asyncPtr = &asyncFrame[asyncBank * MAX_NUM_COLS + asyncCol];
+  // y-address differs
+  if (lcd->y != asyncBank) {
+    return ASYNC_STATE_Y_ADDR;
+  }
+  // x-address differs
+  if (lcd->x != asyncCol) {
+    return ASYNC_STATE_X_ADDR;
+  }
+  // data in bank or column order
+  return (lcd->sendMode == VERTI_ADDR_MODE) ? ASYNC_STATE_VERTI_DATA : ASYNC_STATE_DATA;
+}
+
+/**
+ * @desc    Start asynchronous transfer of prepared spans, first byte is sent
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t * - frame (cache or gray plane)
+ *
+ * @return  void
+ */
+static void PCD8544_AsyncBegin (pcd8544_t *lcd, const uint8_t *frame)
+{
+  // first span
+  asyncLcd = lcd;
+  asyncFrame = frame;
+  asyncBank = PCD8544_AsyncFindBank(lcd, 0);
+  asyncCol = lcd->sendFrom[asyncBank];
+  // chip enable - active low
+  CE_ENABLE (lcd);
+  // addressing mode has to be changed?
+  if (lcd->function != (FUNCTION_SET | BASIC_INS_SET | lcd->sendMode)) {
+    lcd->function = FUNCTION_SET | BASIC_INS_SET | lcd->sendMode;
+    // command (active low)
+    DC_COMMAND (lcd);
+    // normal instruction set / addressing mode
+    SPI_WRITE (lcd->function);
+    // address commands or data
+    asyncState = PCD8544_AsyncAddressState(lcd);
+  } else {
+    // first address command or data
+    asyncState = PCD8544_AsyncAddressState(lcd);
+    PCD8544_AsyncNext ();
+  }
+}
+
+/**
+ * @desc    Start transfer of next display in queue, spans were prepared
+ *          when queue started; displays without modification are skipped
+ *
+ * @param   void
+ *
+ * @return  uint8_t - 0 if queue empty
+ */
+static uint8_t PCD8544_AsyncQueueNext (void)
+{
+  pcd8544_t *lcd;
+  // loop through waiting displays
+  while (asyncQueueLen) {
+    asyncQueueLen--;
+    lcd = *asyncQueue++;
+    // prepared spans of cache, first byte sent
+    if (PCD8544_AsyncFindBank (lcd, 0) < MAX_NUM_ROWS) {
+      PCD8544_AsyncBegin (lcd, lcd->cache);
+      return 1;
+    }
+  }
+  // queue empty
+  return 0;
+}
+
+/**
+ * @desc    Send next byte of asynchronous transfer
+ *          called with SPI idle (start or SPI transfer complete)
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void PCD8544_AsyncNext (void)
+{
+  pcd8544_t *lcd = asyncLcd;
+  uint8_t bank;
+  // state machine
+  switch (asyncState) {
+    // y-address command
+    case ASYNC_STATE_Y_ADDR:
+      // command (active low)
+      DC_COMMAND (lcd);
+      // set y-address (bank)
+      SPI_WRITE (0x40 | asyncBank);
+      lcd->y = asyncBank;
+      // next x-address or data
+      asyncState = PCD8544_AsyncAddressState(lcd);
+      break;
+    // x-address command
+    case ASYNC_STATE_X_ADDR:
+      // command (active low)
+      DC_COMMAND (lcd);
+      // set x-address (column)
+      SPI_WRITE (0x80 | asyncCol);
+      lcd->x = asyncCol;
+      // next data in bank or column order
+      asyncState = PCD8544_AsyncAddressState(lcd);
+      break;
+    // data bytes
+    case ASYNC_STATE_DATA:
+      // data (active high)
+      DC_DATA (lcd);
+      // write data to lcd memory
+      SPI_WRITE (*asyncPtr++);
+      // end of span?
+      if (asyncCol == lcd->sendTo[asyncBank]) {
+        // pointer after span
+        PCD8544_PointerAfterRow (&lcd->x, &lcd->y, asyncBank, asyncCol);
+        // next bank with span
+        bank = PCD8544_AsyncFindBank(lcd, asyncBank + 1);
+        // no more spans
+        if (bank == MAX_NUM_ROWS) {
+          asyncState = ASYNC_STATE_END;
+        // next span, re-address only if auto-increment does not match
+        } else {
+          asyncBank = bank;
+          asyncCol = lcd->sendFrom[bank];
+          asyncState = PCD8544_AsyncAddressState(lcd);
+        }
+      } else {
+        // next column
+        asyncCol++;
+      }
+      break;
+    // data bytes in column order
+    case ASYNC_STATE_VERTI_DATA:
+      // data (active high)
+      DC_DATA (lcd);
+      // write data to lcd memory
+      SPI_WRITE (*asyncPtr);
+      asyncPtr += MAX_NUM_COLS;
+      // end of column?
+      if (asyncBank++ == lcd->sendBankLast) {
+        // pointer after column
+        PCD8544_PointerAfterColumn (&lcd->x, &lcd->y, asyncCol, lcd->sendBankLast);
+        // next column starts in first bank
+        asyncBank = lcd->sendBankFirst;
+        // no more columns
+        if (asyncCol++ == lcd->sendTo[lcd->sendBankFirst]) {
+          asyncState = ASYNC_STATE_END;
+        // re-address only if auto-increment does not match
+        } else {
+          asyncState = PCD8544_AsyncAddressState(lcd);
+        }
+      }
+      break;
+    // transfer done
+    default:
+      // chip disable - idle high
+      CE_DISABLE (lcd);
+      // next display on shared bus, only CE is switched
+      if (PCD8544_AsyncQueueNext ()) {
+        break;
+      }
+      // SPI interrupt disable
+      CLR_BIT (SPCR, SPIE);
+      // release
+      asyncBusy = 0;
+      // notify
+      if (asyncCallback) {
+        asyncCallback();
+      }
+      break;
+  }
+}
+
+/**
+ * @desc    SPI transfer complete interrupt
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+ISR (SPI_STC_vect)
+{
+  // next byte
+  PCD8544_AsyncNext();
+}
+
+/**
+ * @desc    Update screens of displays asynchronously back to back
+ *
+ * @param   pcd8544_t ** - displays, array has to live until transfer ends
+ * @param   uint8_t - number of displays
+ *
+ * @return  char
+ */
+char PCD8544_UpdateScreensAsync (pcd8544_t **lcds, uint8_t count)
+{
+  uint8_t busy;
+  uint8_t i;
+  // test and set against grayscale tick starting transfer
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    busy = asyncBusy;
+    asyncBusy = 1;
+  }
+  // transfer in progress
+  if (busy) {
+    // busy
+    return PCD8544_ERROR;
+  }
+  // take dirty spans of all displays now, SPI_STC_vect only reads
+  // prepared spans and never touches dirty spans drawing extends
+  for (i = 0; i < count; i++) {
+    PCD8544_PrepareSpans (lcds[i]);
+  }
+  // waiting displays
+  asyncQueue = lcds;
+  asyncQueueLen = count;
+  // clear pending SPIF flag (read SPSR, then access SPDR)
+  SPI_STATUS ();
+  // first display with modified content
+  if (!PCD8544_AsyncQueueNext ()) {
+    // nothing modified
+    asyncBusy = 0;
+    // notify
+    if (asyncCallback) {
+      asyncCallback();
+    }
+    // success return
+    return PCD8544_SUCCESS;
+  }
+  // SPI interrupt enable - rest of transfer fed by SPI_STC_vect
+  SET_BIT (SPCR, SPIE);
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Update screen asynchronously
+ *
+ * @param   pcd8544_t *
+ *
+ * @return  char
+ */
+char PCD8544_UpdateScreenAsyncCtx (pcd8544_t *lcd)
+{
+  // transfer in progress
+  if (asyncBusy) {
+    // busy
+    return PCD8544_ERROR;
+  }
+  // queue of one display
+  asyncSingle = lcd;
+  // start transfer
+  return PCD8544_UpdateScreensAsync (&asyncSingle, 1);
+}
+
+/**
+ * @desc    Start grayscale engine
+ *          cache is plane of weight 2, plane of weight 1 is attached;
+ *          engine owns SPI bus until PCD8544_GrayStop
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t * - plane of weight 1, CACHE_SIZE_MEM bytes
+ *
+ * @return  char
+ */
+char PCD8544_GrayStartCtx (pcd8544_t *lcd, uint8_t *plane)
+{
+  // engine already running
+  if (grayLcd) {
+    // busy
+    return PCD8544_ERROR;
+  }
+  // wait for asynchronous transfer
+  while (asyncBusy);
+  // planes of weight 2, 1
+  lcd->gray = plane;
+  grayPlane[0] = lcd->cache;
+  grayPlane[1] = plane;
+  // cycle starts with plane of weight 2
+  grayPhase = 0;
+  grayLcd = lcd;
+#ifdef PCD8544_GRAY_TIMER1
+  // CTC mode, prescaler 8, compare match A at PCD8544_GRAY_HZ
+  TCCR1A = 0;
+  TCNT1 = 0;
+  OCR1A = GRAY_TIMER1_TOP;
+  TCCR1B = (1 << WGM12) | (1 << CS11);
+  // compare match A interrupt enable
+  SET_BIT (GRAY_TIMSK, OCIE1A);
+#endif
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Stop grayscale engine, whole cache is sent on next update
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void PCD8544_GrayStop (void)
+{
+  pcd8544_t *lcd = grayLcd;
+  uint8_t bank;
+  // not running
+  if (!lcd) {
+    return;
+  }
+#ifdef PCD8544_GRAY_TIMER1
+  // compare match A interrupt disable, timer stop
+  CLR_BIT (GRAY_TIMSK, OCIE1A);
+  TCCR1B = 0;
+#endif
+  // following ticks do nothing
+  grayLcd = 0;
+  // wait for last frame
+  while (asyncBusy);
+  // controller may hold plane of weight 1
+  for (bank = 0; bank < MAX_NUM_ROWS; bank++) {
+    PCD8544_MarkDirty (lcd, bank, 0, MAX_NUM_COLS - 1);
+  }
+}
+
+/**
+ * @desc    Next frame of grayscale cycle - timer interrupt body
+ *          plane of weight 2 is shown in frames 0, 1 and plane of weight 1
+ *          in frame 2, so pixel is dark 0 - 3 frames of PCD8544_GRAY_FRAMES;
+ *          controller holds DDRAM, only plane switches are sent, as whole
+ *          frame in background (callback is called after each of them)
+ *
+ * @param   void
+ *
+ * @return  char - PCD8544_ERROR if stopped or previous transfer still
+ *                 running (frame dropped, cycle waits)
+ */
+char PCD8544_GrayTick (void)
+{
+  pcd8544_t *lcd = grayLcd;
+  const uint8_t *frame;
+  uint8_t bank;
+  // engine stopped or bus busy
+  if (!lcd || asyncBusy) {
+    // frame dropped
+    return PCD8544_ERROR;
+  }
+  // plane of frame
+  switch (grayPhase) {
+    // switch to plane of weight 2
+    case 0:
+      frame = grayPlane[0];
+      break;
+    // switch to plane of weight 1
+    case 2:
+      frame = grayPlane[1];
+      break;
+    // controller still holds plane of weight 2
+    default:
+      frame = 0;
+      break;
+  }
+  // next frame of cycle
+  if (++grayPhase == PCD8544_GRAY_FRAMES) {
+    grayPhase = 0;
+  }
+  // nothing to send
+  if (!frame) {
+    // success return
+    return PCD8544_SUCCESS;
+  }
+  // whole frame in bank order, auto-increment wraps to 0, 0
+  for (bank = 0; bank < MAX_NUM_ROWS; bank++) {
+    lcd->sendFrom[bank] = 0;
+    lcd->sendTo[bank] = MAX_NUM_COLS - 1;
+  }
+  lcd->sendMode = HORIZ_ADDR_MODE;
+  // bus taken, no display waiting
+  asyncQueueLen = 0;
+  asyncBusy = 1;
+  // clear pending SPIF flag (read SPSR, then access SPDR)
+  SPI_STATUS ();
+  // first byte
+  PCD8544_AsyncBegin (lcd, frame);
+  // SPI interrupt enable - rest of frame fed by SPI_STC_vect
+  SET_BIT (SPCR, SPIE);
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+#ifdef PCD8544_GRAY_TIMER1
+
+/**
+ * @desc    Timer 1 compare match A interrupt - grayscale frame
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+ISR (TIMER1_COMPA_vect)
+{
+  // next frame of cycle
+  PCD8544_GrayTick ();
+}
+
+#endif
+
+#endif
+
+#endif
+
+#ifndef PCD8544_ASYNC
+
+/**
+ * @desc    Update screen asynchronously
+ *          without transfer complete interrupt (bit-bang transport) or
+ *          with strip rasterized during transfer (banded mode) update
+ *          is blocking and callback is called at the end
+ *
+ * @param   pcd8544_t *
+ *
+ * @return  char
+ */
+char PCD8544_UpdateScreenAsyncCtx (pcd8544_t *lcd)
+{
+  // blocking update
+  PCD8544_UpdateScreenCtx (lcd);
+  // notify
+  if (asyncCallback) {
+    asyncCallback();
+  }
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Update screens of displays back to back
+ *          blocking in banded mode or bit-bang transport, callback
+ *          is called at the end
+ *
+ * @param   pcd8544_t ** - displays
+ * @param   uint8_t - number of displays
+ *
+ * @return  char
+ */
+char PCD8544_UpdateScreensAsync (pcd8544_t **lcds, uint8_t count)
+{
+  // blocking updates
+  PCD8544_UpdateScreens (lcds, count);
+  // notify
+  if (asyncCallback) {
+    asyncCallback();
+  }
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+#endif
+
+/**
+ * @desc    Update screens of displays back to back on shared SPI
+ *          only CE of displays is switched
+ *
+ * @param   pcd8544_t ** - displays
+ * @param   uint8_t - number of displays
+ *
+ * @return  void
+ */
+void PCD8544_UpdateScreens (pcd8544_t **lcds, uint8_t count)
+{
+  // loop through displays
+  while (count--) {
+    // modified content of display
+    PCD8544_UpdateScreenCtx (*lcds++);
+  }
+}
+
+/**
+ * @desc    Asynchronous transfer in progress?
+ *
+ * @param   void
+ *
+ * @return  char - 1 busy, 0 complete
+ */
+char PCD8544_IsBusy (void)
+{
+  // busy flag
+  return asyncBusy;
+}
+
+/**
+ * @desc    Set asynchronous transfer completion callback
+ *          called from interrupt context, NULL disables
+ *
+ * @param   void (*)(void)
+ *
+ * @return  void
+ */
+void PCD8544_SetCallback (void (*callback)(void))
+{
+  // set callback
+  asyncCallback = callback;
+}
+
+/**
+ * @desc    Apply operation on cache byte
+ *
+ * @param   uint8_t * dst
+ * @param   uint8_t bits - source bits (inside mask)
+ * @param   uint8_t mask - affected bits
+ * @param   uint8_t op
+ *
+ * @return  void
+ */
+static inline void PCD8544_ApplyByte (uint8_t *dst, uint8_t bits, uint8_t mask, uint8_t op)
+{
+  switch (op) {
+    // bits set where source set (OR)
+    case PCD8544_OP_SET:
+      *dst |= bits;
+      break;
+    // bits cleared where source set
+    case PCD8544_OP_CLR:
+      *dst &= ~bits;
+      break;
+    // bits inverted where source set
+    case PCD8544_OP_XOR:
+      *dst ^= bits;
+      break;
+    // bits cleared where source clear
+    case PCD8544_OP_AND:
+      *dst &= bits | ~mask;
+      break;
+    // source replaces bits under mask (COPY, transparent)
+    default:
+      *dst = (*dst & ~mask) | bits;
+      break;
+  }
+}
+
+/**
+ * @desc    Blit bitmap in native vertical-byte format (PROGMEM)
+ *          bitmap is ceil(h/8) banks of w bytes, bit 0 top row;
+ *          every source byte is split across two cache banks by shift
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t * bitmap - PROGMEM
+ * @param   const uint8_t * mask - PROGMEM, same layout, NULL if none
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   uint8_t w - width
+ * @param   uint8_t h - height
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+static char PCD8544_Blit (pcd8544_t *lcd, const uint8_t *bitmap, const uint8_t *mask, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t op)
+{
+  // source banks
+  uint8_t banks = (h + 7) >> 3;
+  // visible source columns
+  int16_t c0 = 0, c1 = w - 1;
+  // source bank, column
+  uint8_t sb, c;
+  // destination row / bank of source bank, shift
+  int16_t row;
+  int8_t db;
+  uint8_t shift;
+  // destination banks inside raster window
+  uint8_t upper, lower;
+  // valid bits of source bank
+  uint8_t valid;
+  // shifted source, shifted mask
+  uint16_t bits, msk;
+  const uint8_t *src;
+  uint8_t *dst, *low;
+
+  // clip columns once
+  if (x < 0) {
+    c0 = -x;
+  }
+  if ((x + c1) >= MAX_NUM_COLS) {
+    c1 = MAX_NUM_COLS - 1 - x;
+  }
+  // nothing visible
+  if ((c0 > c1) ||
+      ((y + h) <= 0) ||
+      (y >= (MAX_NUM_ROWS * 8))) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // loop through source banks
+  for (sb = 0; sb < banks; sb++) {
+    // destination row of bit 0
+    row = y + (sb << 3);
+    // whole source bank above or below display
+    if ((row <= -8) || (row >= (MAX_NUM_ROWS * 8))) {
+      continue;
+    }
+    // destination bank (row >= -8, so floor division by shift)
+    db = (row + 8) >> 3;
+    db--;
+    shift = row & 0x07;
+    // destination banks inside raster window
+    upper = (db >= (int8_t) RASTER_FIRST) && (db <= (int8_t) RASTER_LAST);
+    lower = shift && ((db + 1) >= (int8_t) RASTER_FIRST) && ((db + 1) <= (int8_t) RASTER_LAST);
+    // bits of last source bank below height are not part of bitmap
+    valid = ((sb == (banks - 1)) && (h & 0x07)) ? pgm_read_byte(&maskTo[(h & 0x07) - 1]) : 0xFF;
+    // first visible column in upper / lower destination bank
+    dst = upper ? RASTER_PTR(db) + (x + c0) : 0;
+    low = lower ? RASTER_PTR(db + 1) + (x + c0) : 0;
+    // loop through visible columns
+    for (c = c0; c <= c1; c++) {
+      // source byte, shifted into two banks
+      src = bitmap + sb * w + c;
+      bits = (uint16_t) (pgm_read_byte(src) & valid) << shift;
+      // mask byte, shifted into two banks
+      msk = (uint16_t) (mask ? (pgm_read_byte(mask + sb * w + c) & valid) : valid) << shift;
+      // transparent - only bits under mask
+      bits &= msk;
+      // upper destination bank
+      if (upper) {
+        PCD8544_ApplyByte (dst + (c - c0), bits, msk, op);
+      }
+      // lower destination bank
+      if (lower) {
+        PCD8544_ApplyByte (low + (c - c0), bits >> 8, msk >> 8, op);
+      }
+    }
+    // mark modified spans
+    if (upper) {
+      PCD8544_MarkDirty (lcd, db, x + c0, x + c1);
+      FB_WRITES (c1 - c0 + 1);
+    }
+    if (lower) {
+      PCD8544_MarkDirty (lcd, db + 1, x + c0, x + c1);
+      FB_WRITES (c1 - c0 + 1);
+    }
+  }
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Draw bitmap on x, y position
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t * bitmap - PROGMEM, ceil(h/8) banks of w bytes
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   uint8_t w - width
+ * @param   uint8_t h - height
+ * @param   uint8_t op - PCD8544_OP_SET (OR) / _CLR / _XOR / _AND / _COPY
+ *
+ * @return  char
+ */
+char PCD8544_DrawBitmapCtx (pcd8544_t *lcd, const uint8_t *bitmap, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t op)
+{
+#ifdef PCD8544_BANDED
+  // record blit without mask
+  return PCD8544_ListBlit (lcd, bitmap, 0, x, y, w, h, op);
+#else
+  // blit without mask
+  return PCD8544_Blit (lcd, bitmap, 0, x, y, w, h, op);
+#endif
+}
+
+/**
+ * @desc    Draw bitmap with transparency mask on x, y position
+ *          pixels outside mask keep background
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t * bitmap - PROGMEM, ceil(h/8) banks of w bytes
+ * @param   const uint8_t * mask - PROGMEM, same layout
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   uint8_t w - width
+ * @param   uint8_t h - height
+ *
+ * @return  char
+ */
+char PCD8544_DrawBitmapMaskedCtx (pcd8544_t *lcd, const uint8_t *bitmap, const uint8_t *mask, int16_t x, int16_t y, uint8_t w, uint8_t h)
+{
+#ifdef PCD8544_BANDED
+  // record copy under mask
+  return PCD8544_ListBlit (lcd, bitmap, mask, x, y, w, h, PCD8544_OP_COPY);
+#else
+  // copy under mask
+  return PCD8544_Blit (lcd, bitmap, mask, x, y, w, h, PCD8544_OP_COPY);
+#endif
+}
+
+#ifndef PCD8544_BANDED
+/**
+ * @desc    Visible part of sprite footprint in banks and columns
+ *
+ * @param   int16_t x, y - position
+ * @param   uint8_t w, h - size
+ * @param   uint8_t * area - first column, last column, first bank, last bank
+ *
+ * @return  char - error if not visible
+ */
+static char PCD8544_SpriteArea (int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t *area)
+{
+  int16_t x1 = x + w - 1;
+  int16_t y1 = y + h - 1;
+  // nothing visible
+  if ((x1 < 0) || (x >= MAX_NUM_COLS) ||
+      (y1 < 0) || (y >= (MAX_NUM_ROWS * 8))) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // clipped columns
+  area[0] = (x < 0) ? 0 : x;
+  area[1] = (x1 >= MAX_NUM_COLS) ? (MAX_NUM_COLS - 1) : x1;
+  // banks of clipped rows
+  area[2] = (y < 0) ? 0 : (y >> 3);
+  area[3] = (y1 >= (MAX_NUM_ROWS * 8)) ? (MAX_NUM_ROWS - 1) : (y1 >> 3);
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Copy background bytes under sprite footprint into / from
+ *          save buffer, restored bytes are marked dirty
+ *
+ * @param   pcd8544_t *
+ * @param   pcd8544_sprite_t *
+ * @param   int16_t x, y - footprint position
+ * @param   uint8_t restore - 0 save, 1 restore
+ *
+ * @return  void
+ */
+static void PCD8544_SpriteBackground (pcd8544_t *lcd, pcd8544_sprite_t *sprite, int16_t x, int16_t y, uint8_t restore)
+{
+  uint8_t area[4];
+  uint8_t *save = sprite->save;
+  uint8_t bank, len;
+  // footprint not visible
+  if (PCD8544_SpriteArea (x, y, sprite->w, sprite->h, area) != PCD8544_SUCCESS) {
+    return;
+  }
+  len = area[1] - area[0] + 1;
+  // loop through banks of footprint
+  for (bank = area[2]; bank <= area[3]; bank++, save += len) {
+    if (restore) {
+      memcpy (&lcd->cache[bank * MAX_NUM_COLS + area[0]], save, len);
+      // old footprint
+      PCD8544_MarkDirty (lcd, bank, area[0], area[1]);
+      FB_WRITES (len);
+    } else {
+      memcpy (save, &lcd->cache[bank * MAX_NUM_COLS + area[0]], len);
+    }
+  }
+}
+#endif
+
+/**
+ * @desc    Draw sprite layer
+ *
+ * @param   pcd8544_t *
+ * @param   pcd8544_sprite_t * - sprites, first is bottom
+ * @param   uint8_t count
+ *
+ * @return  char
+ */
+char PCD8544_DrawSpritesCtx (pcd8544_t *lcd, pcd8544_sprite_t *sprites, uint8_t count)
+{
+#ifdef PCD8544_BANDED
+  // record layer once, rasterized on current positions
+  return PCD8544_ListSprites (lcd, sprites, count);
+#else
+  pcd8544_sprite_t *sprite;
+  uint8_t first, i;
+  // lowest changed sprite
+  for (first = 0; first < count; first++) {
+    sprite = &sprites[first];
+    if ((sprite->drawn != sprite->visible) ||
+        (sprite->visible && ((sprite->x != sprite->drawnX) ||
+                             (sprite->y != sprite->drawnY) ||
+                             (sprite->bitmap != sprite->drawnBitmap)))) {
+      break;
+    }
+  }
+  // restore backgrounds top down - sprites above changed one cover it
+  for (i = count; i-- > first; ) {
+    sprite = &sprites[i];
+    if (sprite->drawn) {
+      PCD8544_SpriteBackground (lcd, sprite, sprite->drawnX, sprite->drawnY, 1);
+    }
+  }
+  // save backgrounds and composite bottom up
+  for (i = first; i < count; i++) {
+    sprite = &sprites[i];
+    sprite->drawn = sprite->visible;
+    if (!sprite->visible) {
+      continue;
+    }
+    sprite->drawnBitmap = sprite->bitmap;
+    sprite->drawnX = sprite->x;
+    sprite->drawnY = sprite->y;
+    PCD8544_SpriteBackground (lcd, sprite, sprite->x, sprite->y, 0);
+    // new footprint marked dirty by blit (error if outside display)
+    PCD8544_Blit (lcd, sprite->bitmap, sprite->mask, sprite->x, sprite->y, sprite->w, sprite->h, PCD8544_OP_COPY);
+  }
+  // success return
+  return PCD8544_SUCCESS;
+#endif
+}
+
+/**
+ * @desc    Forget sprites on framebuffer
+ *
+ * @param   pcd8544_sprite_t *
+ * @param   uint8_t count
+ *
+ * @return  void
+ */
+void PCD8544_SpritesReset (pcd8544_sprite_t *sprites, uint8_t count)
+{
+  // background not saved, nothing to restore
+  while (count--) {
+    sprites++->drawn = 0;
+  }
+}
+
+/**
+ * @desc    Next byte of PCD8544 RLE stream (PROGMEM)
+ *          packet 0x00 - 0x7F: c + 1 literal bytes follow,
+ *          0x80 - 0xFF: next byte repeated (c & 0x7F) + 3 times
+ *
+ * @param   rle_t *
+ *
+ * @return  uint8_t
+ */
+static inline uint8_t PCD8544_RleNext (rle_t *rle)
+{
+  uint8_t packet;
+  // packet exhausted
+  if (rle->count == 0) {
+    packet = pgm_read_byte(rle->src++);
+    // run
+    if (packet & 0x80) {
+      rle->count = (packet & 0x7F) + 3;
+      rle->value = pgm_read_byte(rle->src++);
+      rle->run = 1;
+    // literal
+    } else {
+      rle->count = packet + 1;
+      rle->run = 0;
+    }
+  }
+  rle->count--;
+  // repeated or next literal byte
+  return rle->run ? rle->value : pgm_read_byte(rle->src++);
+}
+
+/**
+ * @desc    Draw RLE compressed image (PROGMEM) on bank aligned region
+ *          bytes are decoded while previous byte is shifting out and
+ *          sent straight to controller, cache is written too if flags
+ *          contain PCD8544_IMAGE_CACHE (otherwise region of cache is
+ *          stale until redrawn; in banded mode next update redraws it)
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t * image - PROGMEM, PCD8544 RLE of banks x w bytes
+ * @param   uint8_t x - first column
+ * @param   uint8_t bank - first bank
+ * @param   uint8_t w - width
+ * @param   uint8_t banks - height in banks
+ * @param   uint8_t flags - PCD8544_IMAGE_CACHE
+ *
+ * @return  char
+ */
+char PCD8544_DrawImageRleCtx (pcd8544_t *lcd, const uint8_t *image, uint8_t x, uint8_t bank, uint8_t w, uint8_t banks, uint8_t flags)
+{
+  rle_t rle = { image, 0, 0, 0 };
+  // function set, address commands
+  uint8_t address[3];
+  uint8_t len = 0;
+  uint8_t row, col, byte;
+  uint8_t *dst = 0;
+
+  // check region
+  if ((w == 0) || (banks == 0) ||
+      ((x + w) > MAX_NUM_COLS) ||
+      ((bank + banks) > MAX_NUM_ROWS)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+#ifdef PCD8544_BANDED
+  // no cache
+  (void) flags;
+#endif
+  // claim bus - waits for asynchronous transfer, grayscale tick drops frame
+  PCD8544_BusClaim ();
+  // chip enable - active low for whole image
+  CE_ENABLE (lcd);
+  // normal instruction set / horizontal adressing mode, if not already set
+  if (lcd->function != (FUNCTION_SET | BASIC_INS_SET | HORIZ_ADDR_MODE)) {
+    lcd->function = FUNCTION_SET | BASIC_INS_SET | HORIZ_ADDR_MODE;
+    address[len++] = lcd->function;
+  }
+  // loop through banks of region
+  for (row = bank; row < (bank + banks); row++) {
+    // address controller only where auto-increment does not match
+    len += PCD8544_Address (lcd, &address[len], row, x);
+    if (len) {
+      // command (active low)
+      DC_COMMAND (lcd);
+      // transmitting commands
+      PCD8544_SpiStream (address, len);
+      len = 0;
+    }
+#ifndef PCD8544_BANDED
+    // row of cache updated on the fly
+    if (flags & PCD8544_IMAGE_CACHE) {
+      // glass matches cache, no dirty span needed
+      dst = &lcd->cache[row * MAX_NUM_COLS + x];
+      FB_WRITES (w);
+    }
+#endif
+    // data (active high)
+    DC_DATA (lcd);
+    // first byte of row
+    byte = PCD8544_RleNext (&rle);
+    SPI_WRITE (byte);
+    // loop through rest of row
+    for (col = 1; col < w; col++) {
+      // previous byte into cache
+      if (dst) {
+        *dst++ = byte;
+      }
+      // decode next byte while previous one is shifting out
+      byte = PCD8544_RleNext (&rle);
+      // wait till previous byte transmit
+      SPI_WAIT ();
+      // transmitting data
+      SPI_WRITE (byte);
+    }
+    // last byte into cache
+    if (dst) {
+      *dst = byte;
+    }
+    // wait till last byte transmit
+    SPI_WAIT ();
+    // pointer after row
+    PCD8544_PointerAfterRow (&lcd->x, &lcd->y, row, x + w - 1);
+  }
+  // chip disable - idle high
+  CE_DISABLE (lcd);
+  // release bus
+  PCD8544_BusRelease ();
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Draw code point (Unicode BMP)
+ *
+ * @param   pcd8544_t *
+ * @param   uint16_t
+ *
+ * @return  char
+ */
+char PCD8544_DrawCodeCtx (pcd8544_t *lcd, uint16_t code)
+{
+  glyph_t glyph;
+  uint8_t index;
+  // code point without glyph in font
+  if ((PCD8544_GlyphIndex (lcd->font, code, &index) != PCD8544_SUCCESS) ||
+      (PCD8544_GlyphAt (lcd->font, index, &glyph) != PCD8544_SUCCESS)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // character does not fit on row
+  if ((lcd->cursorX + glyph.width) > MAX_NUM_COLS) {
+    // check if whole next row fits into 48 x 84
+    if ((lcd->cursorY + 2 * glyph.height) > (MAX_NUM_ROWS * 8)) {
+      // out of range
+      return PCD8544_ERROR;
+    }
+    // move cursor on new row
+    lcd->cursorX = 0;
+    lcd->cursorY += glyph.height;
+  }
+#ifdef PCD8544_BANDED
+  // record glyph, append to text record if possible
+  if (PCD8544_ListChar (lcd, index, glyph.advance) != PCD8544_SUCCESS) {
+    // display list full
+    return PCD8544_ERROR;
+  }
+#else
+  // glyph from ROM memory on any pixel position
+  PCD8544_Blit (lcd, glyph.bitmap, 0, lcd->cursorX, lcd->cursorY, glyph.width, glyph.height, PCD8544_OP_COPY);
+#endif
+  // glyph + spacing
+  lcd->cursorX += glyph.advance;
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Draw character (byte as code point 0x00 - 0xFF)
+ *
+ * @param   pcd8544_t *
+ * @param   char
+ *
+ * @return  char
+ */
+char PCD8544_DrawCharCtx (pcd8544_t *lcd, char character)
+{
+  // Latin-1 code point
+  return PCD8544_DrawCodeCtx (lcd, (uint8_t) character);
+}
+
+/**
+ * @desc    Draw string (UTF-8)
+ *
+ * @param   pcd8544_t *
+ * @param   char *
+ *
+ * @return  void
+ */
+void PCD8544_DrawStringCtx (pcd8544_t *lcd, char *str)
+{
+  const char *next = str;
+  // loop through characters
+  while (*next != '\0') {
+    // ASCII directly
+    if ((uint8_t) *next < 0x80) {
+      PCD8544_DrawCodeCtx (lcd, (uint8_t) *next++);
+    // multibyte sequence
+    } else {
+      PCD8544_DrawCodeCtx (lcd, PCD8544_Utf8Next (&next));
+    }
+  }
+}
+
+/**
+ * @desc    Set text position
+ *
+ * @param   pcd8544_t *
+ * @param   char x - position / 0 <= rows <= 5 
+ * @param   char y - position / 0 <= cols <= 14
+ *
+ * @return  char
+ */
+char PCD8544_SetTextPositionCtx (pcd8544_t *lcd, char x, char y)
+{
+  // check if x, y is in range
+  if (((uint8_t) x >= MAX_NUM_ROWS) ||
+      ((uint8_t) y >= (MAX_NUM_COLS / 6))) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // text cursor on bank x, character column y
+  // controller is addressed in UpdateScreen
+  lcd->cursorX = y * (CHARS_COLS_LENGTH + 1);
+  lcd->cursorY = x * 8;
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Set text font
+ *
+ * @param   pcd8544_t *
+ * @param   const pcd8544_font_t * font - PROGMEM, NULL built-in 5x7
+ *
+ * @return  void
+ */
+void PCD8544_SetFontCtx (pcd8544_t *lcd, const pcd8544_font_t *font)
+{
+  // used by next characters
+  lcd->font = font;
+}
+
+/**
+ * @desc    Width of UTF-8 string in current font (without trailing spacing)
+ *
+ * @param   pcd8544_t *
+ * @param   const char *
+ *
+ * @return  uint16_t - pixels
+ */
+uint16_t PCD8544_StringWidthCtx (pcd8544_t *lcd, const char *str)
+{
+  glyph_t glyph;
+  uint16_t width = 0;
+  uint8_t index;
+  uint8_t spacing = 0;
+  // loop through characters with glyph
+  while (*str != '\0') {
+    if ((PCD8544_GlyphIndex (lcd->font, PCD8544_Utf8Next (&str), &index) == PCD8544_SUCCESS) &&
+        (PCD8544_GlyphAt (lcd->font, index, &glyph) == PCD8544_SUCCESS)) {
+      width += glyph.advance;
+      spacing = glyph.advance - glyph.width;
+    }
+  }
+  // no space after last glyph
+  return width - spacing;
+}
+
+/**
+ * @desc    Set pixel position
+ *
+ * @param   pcd8544_t *
+ * @param   char x - position / 0 <= rows <= 47 
+ * @param   char y - position / 0 <= cols <= 83
+ * 
+ * @return  char
+ */
+char PCD8544_SetPixelPositionCtx (pcd8544_t *lcd, char x, char y)
+{ 
+  // check if x, y is in range
+  if (((uint8_t) x >= (MAX_NUM_ROWS * 8)) ||
+      ((uint8_t) y >=  MAX_NUM_COLS)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // text cursor on row x, column y
+  // controller is addressed in UpdateScreen
+  lcd->cursorX = y;
+  lcd->cursorY = x;
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Set pixel in raster window
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t row - 0 <= row <= 47
+ * @param   uint8_t col - 0 <= col <= 83
+ *
+ * @return  void
+ */
+static void PCD8544_RasterPixel (pcd8544_t *lcd, uint8_t row, uint8_t col)
+{
+  uint8_t bank = row >> 3;
+  // bank outside raster window
+  if (!RASTER_HAS (bank)) {
+    return;
+  }
+  // set bit
+  RASTER_PTR(bank)[col] |= PCD8544_PixelMask (row);
+  FB_WRITES (1);
+  // mark column as modified
+  PCD8544_MarkDirty (lcd, bank, col, col);
+}
+
+/**
+ * @desc    Draw pixel on x, y position
+ *
+ * @param   pcd8544_t *
+ * @param   char x - position / 0 <= rows <= 47 
+ * @param   char y - position / 0 <= cols <= 83
+ *
+ * @return  char
+ */
+char PCD8544_DrawPixelCtx (pcd8544_t *lcd, char x, char y)
+{ 
+  // check if x, y is in range
+  if (((uint8_t) x >= (MAX_NUM_ROWS * 8)) ||
+      ((uint8_t) y >=  MAX_NUM_COLS)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+#ifdef PCD8544_BANDED
+  // record pixel
+  return PCD8544_ListPixel (lcd, x, y);
+#else
+  // set pixel in cache
+  PCD8544_RasterPixel (lcd, x, y);
+  // success return
+  return PCD8544_SUCCESS;
+#endif
+}
+
+/**
+ * @desc    Apply operation on columns x0..x1 of rows y0..y1 (clipped)
+ *          whole banks are filled by memset, partial banks by one
+ *          precomputed mask per column
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t x0 - first column
+ * @param   uint8_t x1 - last column
+ * @param   uint8_t y0 - first row
+ * @param   uint8_t y1 - last row
+ * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+ *
+ * @return  void
+ */
+static void PCD8544_FillArea (pcd8544_t *lcd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, uint8_t op)
+{
+  uint8_t bank = y0 >> 3;
+  uint8_t last = y1 >> 3;
+  uint8_t len = x1 - x0 + 1;
+
+  // clamp banks to raster window
+#ifdef PCD8544_BANDED
+  if (bank < RASTER_FIRST) {
+    bank = RASTER_FIRST;
+  }
+#endif
+  if (last > RASTER_LAST) {
+    last = RASTER_LAST;
+  }
+  uint8_t mask;
+  uint8_t *ptr;
+  uint8_t i;
+
+  // loop through banks
+  for (; bank <= last; bank++) {
+    // rows covered in bank
+    mask = 0xFF;
+    // first bank starts at y0
+    if (bank == (y0 >> 3)) {
+      mask &= pgm_read_byte(&maskFrom[y0 & 0x07]);
+    }
+    // last bank ends at y1
+    if (bank == (y1 >> 3)) {
+      mask &= pgm_read_byte(&maskTo[y1 & 0x07]);
+    }
+    // first byte of span
+    ptr = RASTER_PTR(bank) + x0;
+    // whole bank set / clear
+    if ((mask == 0xFF) && (op != PCD8544_OP_XOR)) {
+      memset (ptr, (op == PCD8544_OP_SET) ? 0xFF : 0x00, len);
+    // set bits
+    } else if (op == PCD8544_OP_SET) {
+      for (i = 0; i < len; i++) {
+        *ptr++ |= mask;
+      }
+    // clear bits
+    } else if (op == PCD8544_OP_CLR) {
+      mask = ~mask;
+      for (i = 0; i < len; i++) {
+        *ptr++ &= mask;
+      }
+    // invert bits
+    } else {
+      for (i = 0; i < len; i++) {
+        *ptr++ ^= mask;
+      }
+    }
+    // mark span as modified
+    PCD8544_MarkDirty (lcd, bank, x0, x1);
+    FB_WRITES (len);
+  }
+}
+
+/**
+ * @desc    Clip rectangle to display once and fill it
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   int16_t h - height
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+static char PCD8544_ClipFill (pcd8544_t *lcd, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t op)
+{
+  // last column / row
+  int16_t x1 = x + w - 1;
+  int16_t y1 = y + h - 1;
+
+  // clip left / top
+  if (x < 0) {
+    x = 0;
+  }
+  if (y < 0) {
+    y = 0;
+  }
+  // clip right / bottom
+  if (x1 >= MAX_NUM_COLS) {
+    x1 = MAX_NUM_COLS - 1;
+  }
+  if (y1 >= (MAX_NUM_ROWS * 8)) {
+    y1 = (MAX_NUM_ROWS * 8) - 1;
+  }
+  // nothing visible
+  if ((x > x1) || (y > y1)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+#ifdef PCD8544_BANDED
+  // record visible part
+  return PCD8544_ListFill (lcd, x, x1, y, y1, op);
+#else
+  // fill visible part
+  PCD8544_FillArea (lcd, x, x1, y, y1, op);
+  // success return
+  return PCD8544_SUCCESS;
+#endif
+}
+
+/**
+ * @desc    Draw horizontal line
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - start column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_DrawHLineCtx (pcd8544_t *lcd, int16_t x, int16_t y, int16_t w, uint8_t op)
+{
+  // one row span
+  return PCD8544_ClipFill (lcd, x, y, w, 1, op);
+}
+
+/**
+ * @desc    Draw vertical line
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - column
+ * @param   int16_t y - start row
+ * @param   int16_t h - height
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_DrawVLineCtx (pcd8544_t *lcd, int16_t x, int16_t y, int16_t h, uint8_t op)
+{
+  // one column span
+  return PCD8544_ClipFill (lcd, x, y, 1, h, op);
+}
+
+/**
+ * @desc    Draw rectangle outline
+ *          edges do not overlap, so XOR draws corners once
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   int16_t h - height
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_DrawRectCtx (pcd8544_t *lcd, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t op)
+{
+  char status;
+
+  // empty rectangle
+  if ((w <= 0) || (h <= 0)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // top edge
+  status = PCD8544_ClipFill (lcd, x, y, w, 1, op);
+  // bottom edge
+  if (h > 1) {
+    status &= PCD8544_ClipFill (lcd, x, y + h - 1, w, 1, op);
+  }
+  // left / right edge without corners
+  if (h > 2) {
+    // left edge
+    status &= PCD8544_ClipFill (lcd, x, y + 1, 1, h - 2, op);
+    // right edge
+    if (w > 1) {
+      status &= PCD8544_ClipFill (lcd, x + w - 1, y + 1, 1, h - 2, op);
+    }
+  }
+  // error only if nothing visible
+  return status;
+}
+
+/**
+ * @desc    Fill rectangle
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   int16_t h - height
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_FillRectCtx (pcd8544_t *lcd, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t op)
+{
+  // area span
+  return PCD8544_ClipFill (lcd, x, y, w, h, op);
+}
+
+/**
+ * @desc    Decimal digits of number by repeated subtraction of weights
+ *
+ * @param   uint32_t value
+ * @param   char * digits - at least 10 bytes, most significant first
+ *
+ * @return  uint8_t - number of digits (without leading zeros, at least 1)
+ */
+static uint8_t PCD8544_Digits (uint32_t value, char *digits)
+{
+  uint32_t power;
+  uint8_t len = 0;
+  uint8_t i;
+  char digit;
+  // loop through weights above units
+  for (i = 0; i < 9; i++) {
+    power = pgm_read_dword (&powers[i]);
+    // at most 9 subtractions (4 for highest weight)
+    digit = '0';
+    while (value >= power) {
+      value -= power;
+      digit++;
+    }
+    // skip leading zeros
+    if (len || (digit != '0')) {
+      digits[len++] = digit;
+    }
+  }
+  // units
+  digits[len++] = '0' + value;
+  // digits
+  return len;
+}
+
+/**
+ * @desc    Characters of fixed-point number aligned in field cells
+ *
+ * @param   const pcd8544_field_t *
+ * @param   char * text - field->width characters
+ * @param   int32_t value - number * 10^decimals
+ * @param   uint8_t decimals
+ *
+ * @return  char - error if number does not fit field
+ */
+static char PCD8544_FieldText (const pcd8544_field_t *field, char *text, int32_t value, uint8_t decimals)
+{
+  char digits[10];
+  uint8_t count, len, pad, i;
+  // magnitude (INT32_MIN too)
+  uint32_t magnitude = (value < 0) ? (0 - (uint32_t) value) : (uint32_t) value;
+  // significant digits
+  count = PCD8544_Digits (magnitude, digits);
+  // digits shown - at least one before decimal point
+  len = (count > decimals) ? count : (decimals + 1);
+  // characters - sign, digits, decimal point
+  len += (value < 0) + (decimals != 0);
+  if (len > field->width) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  pad = field->width - len;
+  // right aligned - padding before number
+  if (!(field->flags & PCD8544_FIELD_LEFT)) {
+    // spaces before sign
+    if (!(field->flags & PCD8544_FIELD_ZERO)) {
+      memset (text, ' ', pad);
+      text += pad;
+      pad = 0;
+    }
+    // sign
+    if (value < 0) {
+      *text++ = '-';
+    }
+    // zeros after sign
+    memset (text, '0', pad);
+    text += pad;
+    pad = 0;
+  // left aligned - sign
+  } else if (value < 0) {
+    *text++ = '-';
+  }
+  // leading zeros of fraction, digits and decimal point
+  len = (count > decimals) ? count : (decimals + 1);
+  for (i = 0; i < len; i++) {
+    // decimal point before fraction
+    if (decimals && (i == (len - decimals))) {
+      *text++ = '.';
+    }
+    *text++ = (i < (len - count)) ? '0' : digits[i - (len - count)];
+  }
+  // left aligned - padding after number
+  memset (text, ' ', pad);
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Cell size of field in font - widest digit and font height
+ *
+ * @param   pcd8544_t *
+ * @param   pcd8544_field_t *
+ *
+ * @return  char - error if font has no digit
+ */
+static char PCD8544_FieldPitch (pcd8544_t *lcd, pcd8544_field_t *field)
+{
+  glyph_t glyph;
+  uint8_t index;
+  char digit;
+  // cells on glass unknown
+  memset (field->cells, 0, sizeof(field->cells));
+  field->font = lcd->font;
+  field->pitch = 0;
+  // tabular cells of widest digit
+  for (digit = '0'; digit <= '9'; digit++) {
+    if ((PCD8544_GlyphIndex (lcd->font, digit, &index) == PCD8544_SUCCESS) &&
+        (PCD8544_GlyphAt (lcd->font, index, &glyph) == PCD8544_SUCCESS) &&
+        (glyph.advance > field->pitch)) {
+      field->pitch = glyph.advance;
+      field->height = glyph.height;
+    }
+  }
+  // font without digits
+  return field->pitch ? PCD8544_SUCCESS : PCD8544_ERROR;
+}
+
+#ifndef PCD8544_BANDED
+/**
+ * @desc    Write bits under mask into cache byte, mark byte dirty only
+ *          if it changes
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t bank
+ * @param   uint8_t col
+ * @param   uint8_t bits - inside mask
+ * @param   uint8_t mask
+ *
+ * @return  void
+ */
+static inline void PCD8544_FieldByte (pcd8544_t *lcd, uint8_t bank, uint8_t col, uint8_t bits, uint8_t mask)
+{
+  uint8_t *dst = &lcd->cache[bank * MAX_NUM_COLS + col];
+  uint8_t byte = (*dst & ~mask) | bits;
+  // byte on glass already
+  if (byte == *dst) {
+    return;
+  }
+  *dst = byte;
+  // only this column of bank
+  PCD8544_MarkDirty (lcd, bank, col, col);
+  FB_WRITES (1);
+}
+#endif
+
+/**
+ * @desc    Render one cell of field - glyph centered in cell, rest cleared
+ *
+ * @param   pcd8544_t *
+ * @param   const pcd8544_field_t *
+ * @param   uint8_t x - first column of cell
+ * @param   const glyph_t * - NULL blank cell
+ * @param   uint8_t index - glyph of font
+ *
+ * @return  char
+ */
+static char PCD8544_FieldCell (pcd8544_t *lcd, const pcd8544_field_t *field, uint8_t x, const glyph_t *glyph, uint8_t index)
+{
+  // first glyph column in cell
+  uint8_t offset = glyph ? ((field->pitch - glyph->advance) >> 1) : 0;
+#ifdef PCD8544_BANDED
+  uint8_t cursorX = lcd->cursorX;
+  uint8_t cursorY = lcd->cursorY;
+  char status;
+  // clear cell
+  if (PCD8544_ClipFill (lcd, x, field->y, field->pitch, field->height, PCD8544_OP_CLR) != PCD8544_SUCCESS) {
+    // display list full
+    return PCD8544_ERROR;
+  }
+  // blank cell
+  if (!glyph) {
+    // success return
+    return PCD8544_SUCCESS;
+  }
+  // glyph as text record on cell, text cursor kept
+  lcd->cursorX = x + offset;
+  lcd->cursorY = field->y;
+  status = PCD8544_ListChar (lcd, index, glyph->advance);
+  lcd->cursorX = cursorX;
+  lcd->cursorY = cursorY;
+  // status
+  return status;
+#else
+  uint8_t banks = (field->height + 7) >> 3;
+  uint8_t c, sb, row, col;
+  uint8_t valid;
+  uint16_t bits, msk;
+  // glyph bitmap used directly
+  (void) index;
+  // loop through columns of cell
+  for (c = 0; c < field->pitch; c++) {
+    col = x + c;
+    // loop through source banks of glyph
+    for (sb = 0; sb < banks; sb++) {
+      row = field->y + (sb << 3);
+      // rows of cell in source bank
+      valid = ((sb == (banks - 1)) && (field->height & 0x07)) ? pgm_read_byte(&maskTo[(field->height & 0x07) - 1]) : 0xFF;
+      msk = (uint16_t) valid << (row & 0x07);
+      // glyph column or blank
+      bits = 0;
+      if (glyph && ((uint8_t) (c - offset) < glyph->width)) {
+        bits = (uint16_t) (pgm_read_byte(glyph->bitmap + sb * glyph->width + (uint8_t) (c - offset)) & valid) << (row & 0x07);
+      }
+      // upper and lower destination bank
+      PCD8544_FieldByte (lcd, row >> 3, col, bits, msk);
+      if (msk >> 8) {
+        PCD8544_FieldByte (lcd, (row >> 3) + 1, col, bits >> 8, msk >> 8);
+      }
+    }
+  }
+#endif
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Draw fixed-point number into field, changed cells only
+ *
+ * @param   pcd8544_t *
+ * @param   pcd8544_field_t *
+ * @param   int32_t value - number * 10^decimals
+ * @param   uint8_t decimals
+ *
+ * @return  char
+ */
+static char PCD8544_FieldDraw (pcd8544_t *lcd, pcd8544_field_t *field, int32_t value, uint8_t decimals)
+{
+  char text[PCD8544_FIELD_CELLS];
+  glyph_t glyph;
+  uint8_t index;
+  uint8_t i, x;
+  char status = PCD8544_SUCCESS;
+  // first draw or font changed
+  if ((!field->pitch || (field->font != lcd->font)) &&
+      (PCD8544_FieldPitch (lcd, field) != PCD8544_SUCCESS)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // field inside display, number fits field
+  if ((decimals > 9) ||
+      (field->width > PCD8544_FIELD_CELLS) ||
+      ((field->x + field->width * field->pitch) > MAX_NUM_COLS) ||
+      ((field->y + field->height) > (MAX_NUM_ROWS * 8)) ||
+      (PCD8544_FieldText (field, text, value, decimals) != PCD8544_SUCCESS)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // loop through cells
+  for (i = 0, x = field->x; i < field->width; i++, x += field->pitch) {
+    // same character on glass
+    if (text[i] == field->cells[i]) {
+      continue;
+    }
+    // glyph of character, space or missing glyph blank
+    if ((text[i] != ' ') &&
+        (PCD8544_GlyphIndex (lcd->font, text[i], &index) == PCD8544_SUCCESS) &&
+        (PCD8544_GlyphAt (lcd->font, index, &glyph) == PCD8544_SUCCESS)) {
+      status = PCD8544_FieldCell (lcd, field, x, &glyph, index);
+    } else {
+      status = PCD8544_FieldCell (lcd, field, x, 0, 0);
+    }
+    // cell not rendered (display list full), retried next draw
+    if (status != PCD8544_SUCCESS) {
+      break;
+    }
+    field->cells[i] = text[i];
+  }
+  // status
+  return status;
+}
+
+/**
+ * @desc    Forget characters of field on glass
+ *
+ * @param   pcd8544_field_t *
+ *
+ * @return  void
+ */
+void PCD8544_FieldReset (pcd8544_field_t *field)
+{
+  // cell size and cells recomputed by next draw
+  field->pitch = 0;
+}
+
+/**
+ * @desc    Draw integer into field
+ *
+ * @param   pcd8544_t *
+ * @param   pcd8544_field_t *
+ * @param   int32_t value
+ *
+ * @return  char
+ */
+char PCD8544_DrawIntCtx (pcd8544_t *lcd, pcd8544_field_t *field, int32_t value)
+{
+  // no decimal point
+  return PCD8544_FieldDraw (lcd, field, value, 0);
+}
+
+/**
+ * @desc    Draw fixed-point number into field
+ *
+ * @param   pcd8544_t *
+ * @param   pcd8544_field_t *
+ * @param   int32_t value - number * 10^decimals
+ * @param   uint8_t decimals
+ *
+ * @return  char
+ */
+char PCD8544_DrawFixedCtx (pcd8544_t *lcd, pcd8544_field_t *field, int32_t value, uint8_t decimals)
+{
+  // decimal point before last decimals digits
+  return PCD8544_FieldDraw (lcd, field, value, decimals);
+}
+
+/**
+ * @desc    Text of console screen row
+ *
+ * @param   pcd8544_console_t *
+ * @param   uint8_t row - screen row
+ *
+ * @return  char * - PCD8544_CONSOLE_COLS characters
+ */
+static inline char * PCD8544_ConsoleText (pcd8544_console_t *console, uint8_t row)
+{
+  // ring row
+  row += console->head;
+  if (row >= PCD8544_CONSOLE_ROWS) {
+    row -= PCD8544_CONSOLE_ROWS;
+  }
+  return console->text[row];
+}
+
+/**
+ * @desc    Built-in glyph of console character, zero (not cleared
+ *          console) as space
+ *
+ * @param   char
+ *
+ * @return  const uint8_t * - PROGMEM
+ */
+static inline const uint8_t * PCD8544_ConsoleGlyph (char character)
+{
+  uint8_t index = (uint8_t) character - 0x20;
+  // outside built-in font 0x20 - 0x7F
+  if (index >= 0x60) {
+    index = 0;
+  }
+  return FONTS[index];
+}
+
+/**
+ * @desc    Move console cursor to start of next row, scroll if on last row
+ *
+ * @param   pcd8544_console_t *
+ *
+ * @return  void
+ */
+static void PCD8544_ConsoleNewLine (pcd8544_console_t *console)
+{
+  // row start
+  console->col = 0;
+  // next row
+  if (console->row < (PCD8544_CONSOLE_ROWS - 1)) {
+    console->row++;
+    return;
+  }
+  // scroll - top row of ring becomes empty bottom row
+  memset (console->text[console->head], ' ', PCD8544_CONSOLE_COLS);
+  if (++console->head == PCD8544_CONSOLE_ROWS) {
+    console->head = 0;
+  }
+  // every row moved one bank up
+  console->dirty = (1 << PCD8544_CONSOLE_ROWS) - 1;
+}
+
+/**
+ * @desc    Clear console, cursor home
+ *
+ * @param   pcd8544_console_t *
+ *
+ * @return  void
+ */
+void PCD8544_ConsoleClear (pcd8544_console_t *console)
+{
+  // empty rows
+  memset (console->text, ' ', sizeof(console->text));
+  console->head = 0;
+  console->row = 0;
+  console->col = 0;
+  // all rows re-rendered by flush
+  console->dirty = (1 << PCD8544_CONSOLE_ROWS) - 1;
+}
+
+/**
+ * @desc    Put character on console cursor
+ *
+ * @param   pcd8544_console_t *
+ * @param   char
+ *
+ * @return  void
+ */
+void PCD8544_ConsolePutc (pcd8544_console_t *console, char character)
+{
+  switch (character) {
+    // new line, row start
+    case '\n':
+      PCD8544_ConsoleNewLine (console);
+      return;
+    // row start
+    case '\r':
+      console->col = 0;
+      return;
+    // cursor left
+    case '\b':
+      if (console->col) {
+        console->col--;
+      }
+      return;
+    // next tab stop, wraps with next character
+    case '\t':
+      console->col = (console->col / PCD8544_CONSOLE_TAB + 1) * PCD8544_CONSOLE_TAB;
+      if (console->col > PCD8544_CONSOLE_COLS) {
+        console->col = PCD8544_CONSOLE_COLS;
+      }
+      return;
+    // clear to end of row
+    case PCD8544_CONSOLE_EOL:
+      if (console->col < PCD8544_CONSOLE_COLS) {
+        memset (&PCD8544_ConsoleText (console, console->row)[console->col], ' ', PCD8544_CONSOLE_COLS - console->col);
+        console->dirty |= 1 << console->row;
+      }
+      return;
+    // clear console
+    case PCD8544_CONSOLE_CLS:
+      PCD8544_ConsoleClear (console);
+      return;
+  }
+  // other control characters ignored
+  if ((uint8_t) character < 0x20) {
+    return;
+  }
+  // wrap pending from previous character
+  if (console->col == PCD8544_CONSOLE_COLS) {
+    PCD8544_ConsoleNewLine (console);
+  }
+  // built-in font 0x20 - 0x7F
+  PCD8544_ConsoleText (console, console->row)[console->col++] = ((uint8_t) character < 0x80) ? character : '?';
+  console->dirty |= 1 << console->row;
+}
+
+/**
+ * @desc    Put string on console
+ *
+ * @param   pcd8544_console_t *
+ * @param   const char *
+ *
+ * @return  void
+ */
+void PCD8544_ConsolePuts (pcd8544_console_t *console, const char *str)
+{
+  // loop through characters
+  while (*str != '\0') {
+    PCD8544_ConsolePutc (console, *str++);
+  }
+}
+
+/**
+ * @desc    Render changed or moved console rows into their banks and send
+ *          them - framebuffer bytes are written and marked dirty only if
+ *          they differ, in banded mode rows are streamed to controller
+ *          directly (display list keeps its own content)
+ *
+ * @param   pcd8544_t *
+ * @param   pcd8544_console_t *
+ *
+ * @return  void
+ */
+void PCD8544_ConsoleFlushCtx (pcd8544_t *lcd, pcd8544_console_t *console)
+{
+  const char *text;
+  const uint8_t *glyph;
+  uint8_t row, i, c;
+#ifdef PCD8544_BANDED
+  // glyph + 1 column space
+  uint8_t columns[CHARS_COLS_LENGTH + 1];
+  // function set, address commands
+  uint8_t address[3];
+  uint8_t len = 0;
+
+  // nothing changed
+  if (!console->dirty) {
+    return;
+  }
+  // claim bus - waits for asynchronous transfer, grayscale tick drops frame
+  PCD8544_BusClaim ();
+  // chip enable - active low for all rows
+  CE_ENABLE (lcd);
+  // normal instruction set / horizontal adressing mode, if not already set
+  if (lcd->function != (FUNCTION_SET | BASIC_INS_SET | HORIZ_ADDR_MODE)) {
+    lcd->function = FUNCTION_SET | BASIC_INS_SET | HORIZ_ADDR_MODE;
+    address[len++] = lcd->function;
+  }
+  columns[CHARS_COLS_LENGTH] = 0x00;
+#else
+  uint8_t *dst;
+  uint8_t byte, from, to;
+#endif
+  // loop through screen rows
+  for (row = 0; row < PCD8544_CONSOLE_ROWS; row++) {
+    // row not changed nor moved
+    if (!(console->dirty & (1 << row))) {
+      continue;
+    }
+    text = PCD8544_ConsoleText (console, row);
+#ifdef PCD8544_BANDED
+    // address controller only where auto-increment does not match
+    len += PCD8544_Address (lcd, &address[len], row, 0);
+    if (len) {
+      // command (active low)
+      DC_COMMAND (lcd);
+      // transmitting commands
+      PCD8544_SpiStream (address, len);
+      len = 0;
+    }
+    // data (active high)
+    DC_DATA (lcd);
+    // loop through characters of row
+    for (i = 0; i < PCD8544_CONSOLE_COLS; i++) {
+      glyph = PCD8544_ConsoleGlyph (text[i]);
+      for (c = 0; c < CHARS_COLS_LENGTH; c++) {
+        columns[c] = pgm_read_byte(&glyph[c]);
+      }
+      // glyph columns in one burst
+      PCD8544_SpiStream (columns, CHARS_COLS_LENGTH + 1);
+    }
+    // pointer after row
+    PCD8544_PointerAfterRow (&lcd->x, &lcd->y, row, MAX_NUM_COLS - 1);
+#else
+    // bank of row
+    dst = &lcd->cache[row * MAX_NUM_COLS];
+    from = 0xFF;
+    to = 0;
+    // loop through characters of row
+    for (i = 0; i < PCD8544_CONSOLE_COLS; i++) {
+      glyph = PCD8544_ConsoleGlyph (text[i]);
+      // glyph + 1 column space
+      for (c = 0; c <= CHARS_COLS_LENGTH; c++, dst++) {
+        byte = (c < CHARS_COLS_LENGTH) ? pgm_read_byte(&glyph[c]) : 0x00;
+        // byte on glass already
+        if (*dst == byte) {
+          continue;
+        }
+        *dst = byte;
+        FB_WRITES (1);
+        // span of changed bytes
+        to = i * (CHARS_COLS_LENGTH + 1) + c;
+        if (from == 0xFF) {
+          from = to;
+        }
+      }
+    }
+    // mark changed span
+    if (from != 0xFF) {
+      PCD8544_MarkDirty (lcd, row, from, to);
+    }
+#endif
+  }
+  // all rows rendered
+  console->dirty = 0;
+#ifdef PCD8544_BANDED
+  // chip disable - idle high
+  CE_DISABLE (lcd);
+  // release bus
+  PCD8544_BusRelease ();
+#else
+  // send changed spans
+  PCD8544_UpdateScreenCtx (lcd);
+#endif
+}
+
+/**
+ * @desc    Clear strip chart
+ *
+ * @param   pcd8544_chart_t *
+ *
+ * @return  void
+ */
+void PCD8544_ChartClear (pcd8544_chart_t *chart)
+{
+  // empty columns
+  memset (chart->columns, 0x00, chart->banks * chart->w);
+  chart->head = 0;
+  // no previous sample to connect
+  chart->last = 0xFF;
+}
+
+/**
+ * @desc    Append sample to strip chart - newest column of ring rendered
+ *
+ * @param   pcd8544_chart_t *
+ * @param   uint8_t value - 0 bottom row
+ *
+ * @return  void
+ */
+void PCD8544_ChartPush (pcd8544_chart_t *chart, uint8_t value)
+{
+  // bottom row of region
+  uint8_t bottom = (chart->banks << 3) - 1;
+  // column of oldest sample is reused
+  uint8_t *column = chart->columns + chart->head;
+  uint8_t row, from, to, bank, mask;
+
+  // clip to top row
+  if (value > bottom) {
+    value = bottom;
+  }
+  row = bottom - value;
+  from = row;
+  to = row;
+  // vertical segment from previous sample
+  if ((chart->flags & PCD8544_CHART_LINE) && (chart->last != 0xFF)) {
+    if (chart->last < from) {
+      from = chart->last;
+    } else {
+      to = chart->last;
+    }
+  }
+  // loop through banks of column
+  for (bank = 0; bank < chart->banks; bank++, column += chart->w) {
+    mask = 0x00;
+    // rows from .. to in bank
+    if (((from >> 3) <= bank) && ((to >> 3) >= bank)) {
+      mask = 0xFF;
+      if (bank == (from >> 3)) {
+        mask &= pgm_read_byte(&maskFrom[from & 0x07]);
+      }
+      if (bank == (to >> 3)) {
+        mask &= pgm_read_byte(&maskTo[to & 0x07]);
+      }
+    }
+    *column = mask;
+  }
+  chart->last = row;
+  // oldest sample moves to next column
+  if (++chart->head == chart->w) {
+    chart->head = 0;
+  }
+}
+
+/**
+ * @desc    Copy ring of strip chart into banks of raster window,
+ *          oldest column (head) on left edge of region
+ *
+ * @param   pcd8544_t *
+ * @param   const pcd8544_chart_t *
+ *
+ * @return  void
+ */
+static void PCD8544_ChartRaster (pcd8544_t *lcd, const pcd8544_chart_t *chart)
+{
+  // columns from head to end of ring
+  uint8_t tail = chart->w - chart->head;
+  const uint8_t *src = chart->columns;
+  uint8_t *dst;
+  uint8_t bank;
+
+  // loop through banks of region
+  for (bank = chart->bank; bank < (chart->bank + chart->banks); bank++, src += chart->w) {
+    // bank outside raster window
+    if (!RASTER_HAS (bank)) {
+      continue;
+    }
+    dst = RASTER_PTR(bank) + chart->x;
+    // oldest samples on left
+    memcpy (dst, src + chart->head, tail);
+    // newest samples on right
+    memcpy (dst + tail, src, chart->head);
+    // mark span as modified
+    PCD8544_MarkDirty (lcd, bank, chart->x, chart->x + chart->w - 1);
+    FB_WRITES (chart->w);
+  }
+}
+
+/**
+ * @desc    Draw strip chart
+ *
+ * @param   pcd8544_t *
+ * @param   pcd8544_chart_t *
+ *
+ * @return  char
+ */
+char PCD8544_DrawChartCtx (pcd8544_t *lcd, pcd8544_chart_t *chart)
+{
+  // check region
+  if ((chart->w == 0) || (chart->banks == 0) ||
+      ((chart->x + chart->w) > MAX_NUM_COLS) ||
+      ((chart->bank + chart->banks) > MAX_NUM_ROWS)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+#ifdef PCD8544_BANDED
+  // record chart, rotated on update
+  return PCD8544_ListChart (lcd, chart);
+#else
+  // rotate ring into region
+  PCD8544_ChartRaster (lcd, chart);
+  // success return
+  return PCD8544_SUCCESS;
+#endif
+}
+
+#ifndef PCD8544_BANDED
+
+/**
+ * @desc    Scroll region vertically by pixels, vacated rows cleared
+ *          every destination byte is built from two source bytes of
+ *          banks dy / 8 and dy / 8 + 1 away, shifted by dy % 8
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   int16_t h - height
+ * @param   int8_t dy - rows, negative up, positive down
+ *
+ * @return  char
+ */
+char PCD8544_ScrollRegionCtx (pcd8544_t *lcd, int16_t x, int16_t y, int16_t w, int16_t h, int8_t dy)
+{
+  // last column / row
+  int16_t x1 = x + w - 1;
+  int16_t y1 = y + h - 1;
+  // rows of region in banks
+  uint8_t mask[MAX_NUM_ROWS];
+  uint8_t first, last, bank, src;
+  uint8_t rows, banks, shift;
+  uint8_t bits;
+  uint8_t *col;
+
+  // clip to display
+  if (x < 0) {
+    x = 0;
+  }
+  if (y < 0) {
+    y = 0;
+  }
+  if (x1 >= MAX_NUM_COLS) {
+    x1 = MAX_NUM_COLS - 1;
+  }
+  if (y1 >= (MAX_NUM_ROWS * 8)) {
+    y1 = (MAX_NUM_ROWS * 8) - 1;
+  }
+  // nothing visible
+  if ((x > x1) || (y > y1)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // nothing to move
+  if (dy == 0) {
+    // success return
+    return PCD8544_SUCCESS;
+  }
+  rows = (dy < 0) ? -dy : dy;
+  // whole region vacated
+  if (rows > (y1 - y)) {
+    PCD8544_FillArea (lcd, x, x1, y, y1, PCD8544_OP_CLR);
+    // success return
+    return PCD8544_SUCCESS;
+  }
+  first = y >> 3;
+  last = y1 >> 3;
+  banks = rows >> 3;
+  shift = rows & 0x07;
+  // rows of region in every bank
+  for (bank = first; bank <= last; bank++) {
+    mask[bank] = 0xFF;
+    if (bank == first) {
+      mask[bank] &= pgm_read_byte(&maskFrom[y & 0x07]);
+    }
+    if (bank == last) {
+      mask[bank] &= pgm_read_byte(&maskTo[y1 & 0x07]);
+    }
+  }
+  // loop through columns
+  for (col = &lcd->cache[x]; col <= &lcd->cache[x1]; col++) {
+    // up - destination banks top down, sources below them
+    if (dy < 0) {
+      for (bank = first; bank <= last; bank++) {
+        bits = 0;
+        src = bank + banks;
+        if (src <= last) {
+          bits = (col[src * MAX_NUM_COLS] & mask[src]) >> shift;
+        }
+        if (shift && (src < last)) {
+          bits |= (col[(src + 1) * MAX_NUM_COLS] & mask[src + 1]) << (8 - shift);
+        }
+        col[bank * MAX_NUM_COLS] = (col[bank * MAX_NUM_COLS] & ~mask[bank]) | (bits & mask[bank]);
+      }
+    // down - destination banks bottom up, sources above them
+    } else {
+      for (bank = last + 1; bank-- > first; ) {
+        bits = 0;
+        if (bank >= (first + banks)) {
+          src = bank - banks;
+          bits = (col[src * MAX_NUM_COLS] & mask[src]) << shift;
+          if (shift && (src > first)) {
+            bits |= (col[(src - 1) * MAX_NUM_COLS] & mask[src - 1]) >> (8 - shift);
+          }
+        }
+        col[bank * MAX_NUM_COLS] = (col[bank * MAX_NUM_COLS] & ~mask[bank]) | (bits & mask[bank]);
+      }
+    }
+  }
+  // mark modified spans
+  for (bank = first; bank <= last; bank++) {
+    PCD8544_MarkDirty (lcd, bank, x, x1);
+    FB_WRITES (x1 - x + 1);
+  }
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+#endif
+
+/**
+ * @desc    Cohen-Sutherland region code of point
+ *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ *
+ * @return  uint8_t
+ */
+static uint8_t PCD8544_OutCode (int16_t x, int16_t y)
+{
+  uint8_t code = CLIP_INSIDE;
+  // left / right of display
+  if (x < 0) {
+    code |= CLIP_LEFT;
+  } else if (x >= MAX_NUM_COLS) {
+    code |= CLIP_RIGHT;
+  }
+  // above / below display
+  if (y < 0) {
+    code |= CLIP_TOP;
+  } else if (y >= (MAX_NUM_ROWS * 8)) {
+    code |= CLIP_BOTTOM;
+  }
+  // region code
+  return code;
+}
+
+/**
+ * @desc    Clip line to display by Cohen-Sutherland algorithm
+ * @surce   https://en.wikipedia.org/wiki/Cohen%E2%80%93Sutherland_algorithm
+ *
+ * @param   int16_t * x0
+ * @param   int16_t * y0
+ * @param   int16_t * x1
+ * @param   int16_t * y1
+ *
+ * @return  char
+ */
+static char PCD8544_ClipLine (int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1)
+{
+  uint8_t code0 = PCD8544_OutCode (*x0, *y0);
+  uint8_t code1 = PCD8544_OutCode (*x1, *y1);
+  uint8_t code;
+  int16_t x, y;
+
+  // until both points inside
+  while (code0 | code1) {
+    // both points on the same outer side
+    if (code0 & code1) {
+      // out of range
+      return PCD8544_ERROR;
+    }
+    // outside point
+    code = code0 ? code0 : code1;
+    // intersection with display edge
+    if (code & CLIP_BOTTOM) {
+      y = (MAX_NUM_ROWS * 8) - 1;
+      x = *x0 + (int32_t) (*x1 - *x0) * (y - *y0) / (*y1 - *y0);
+    } else if (code & CLIP_TOP) {
+      y = 0;
+      x = *x0 + (int32_t) (*x1 - *x0) * (y - *y0) / (*y1 - *y0);
+    } else if (code & CLIP_RIGHT) {
+      x = MAX_NUM_COLS - 1;
+      y = *y0 + (int32_t) (*y1 - *y0) * (x - *x0) / (*x1 - *x0);
+    } else {
+      x = 0;
+      y = *y0 + (int32_t) (*y1 - *y0) * (x - *x0) / (*x1 - *x0);
+    }
+    // replace outside point
+    if (code == code0) {
+      *x0 = x;
+      *y0 = y;
+      code0 = PCD8544_OutCode (x, y);
+    } else {
+      *x1 = x;
+      *y1 = y;
+      code1 = PCD8544_OutCode (x, y);
+    }
+  }
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+#ifdef PCD8544_BANDED
+  // plot only pixels of bank held in strip
+  #define LINE_START(row, col)
+  #define LINE_MOVE(offset)
+  #define LINE_PLOT()           if (bank == rasterBank) { cacheMemLcd[x] |= mask; FB_WRITES (1); }
+#else
+  // plot through cache pointer, all steps + 1 pixels counted at start
+  #define LINE_START(row, col)  ptr = &lcd->cache[PCD8544_PixelIndex (row, col)]; FB_WRITES (steps + 1)
+  #define LINE_MOVE(offset)     ptr += (offset)
+  #define LINE_PLOT()           *ptr |= mask
+#endif
+
+/**
+ * @desc    Rasterize line by Bresenham algoritm
+ *          clipped once, then cache pointer and bit mask are stepped
+ *          incrementally; horizontal / vertical lines use span kernel
+ * @surce   https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
+ *  
+ * @param   pcd8544_t *
+ * @param   char x - position / 0 <= cols <= 83 
+ * @param   char x - position / 0 <= cols <= 83 
+ * @param   char y - position / 0 <= rows <= 47 
+ * @param   char y - position / 0 <= rows <= 47
+ *
+ * @return  char
+ */
+static char PCD8544_RasterLine (pcd8544_t *lcd, char x1, char x2, char y1, char y2)
+{
+  int16_t xa = x1, ya = y1;
+  int16_t xb = x2, yb = y2;
+  // deltas
+  int16_t delta_x, delta_y;
+  // error term
+  int16_t error, error2;
+  // cache pointer, bit mask
+#ifndef PCD8544_BANDED
+  uint8_t *ptr;
+#endif
+  uint8_t mask;
+  // current column, first column in current bank, bank
+  uint8_t x, from, bank;
+  // steps
+  uint8_t steps;
+  int8_t trace_y = 1;
+
+  // clip to display
+  if (PCD8544_ClipLine (&xa, &ya, &xb, &yb) != PCD8544_SUCCESS) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // draw always from left to right
+  if (xa > xb) {
+    // swap x
+    error = xa; xa = xb; xb = error;
+    // swap y
+    error = ya; ya = yb; yb = error;
+  }
+  // horizontal line
+  if (ya == yb) {
+    PCD8544_FillArea (lcd, xa, xb, ya, ya, PCD8544_OP_SET);
+    // success return
+    return PCD8544_SUCCESS;
+  }
+  // vertical line
+  if (xa == xb) {
+    PCD8544_FillArea (lcd, xa, xa, (ya < yb) ? ya : yb, (ya < yb) ? yb : ya, PCD8544_OP_SET);
+    // success return
+    return PCD8544_SUCCESS;
+  }
+
+  // deltas
+  delta_x = xb - xa;
+  delta_y = yb - ya;
+  // check if y2 > y1
+  if (delta_y < 0) {
+    // negate detla y
+    delta_y = -delta_y;
+    // negate step y
+    trace_y = -trace_y;
+  }
+  // number of steps
+  steps = (delta_x > delta_y) ? delta_x : delta_y;
+  // error term
+  error = delta_x - delta_y;
+  // start position
+  x = from = xa;
+  bank = ya >> 3;
+  LINE_START (ya, xa);
+  mask = PCD8544_PixelMask (ya);
+
+  // draw first pixel
+  LINE_PLOT ();
+  // loop through steps
+  while (steps--) {
+    error2 = 2 * error;
+    // step in x
+    if (error2 > -delta_y) {
+      error -= delta_y;
+      x++;
+      LINE_MOVE (1);
+    }
+    // step in y
+    if (error2 < delta_x) {
+      error += delta_x;
+      // down
+      if (trace_y > 0) {
+        mask <<= 1;
+        // crossing to bank below
+        if (mask == 0) {
+          mask = 0x01;
+          LINE_MOVE (MAX_NUM_COLS);
+          // mark segment in previous bank
+          PCD8544_MarkDirty (lcd, bank++, from, x);
+          from = x;
+        }
+      // up
+      } else {
+        mask >>= 1;
+        // crossing to bank above
+        if (mask == 0) {
+          mask = 0x80;
+          LINE_MOVE (-MAX_NUM_COLS);
+          // mark segment in previous bank
+          PCD8544_MarkDirty (lcd, bank--, from, x);
+          from = x;
+        }
+      }
+    }
+    // draw next pixel
+    LINE_PLOT ();
+  }
+  // mark segment in last bank
+  PCD8544_MarkDirty (lcd, bank, from, x);
+  // success return
+  return PCD8544_SUCCESS;
+}
+
+/**
+ * @desc    Draw line by Bresenham algoritm
+ * @surce   https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
+ *  
+ * @param   pcd8544_t *
+ * @param   char x - position / 0 <= cols <= 83 
+ * @param   char x - position / 0 <= cols <= 83 
+ * @param   char y - position / 0 <= rows <= 47 
+ * @param   char y - position / 0 <= rows <= 47
+ *
+ * @return  char
+ */
+char PCD8544_DrawLineCtx (pcd8544_t *lcd, char x1, char x2, char y1, char y2)
+{
+#ifdef PCD8544_BANDED
+  int16_t xa = x1, ya = y1;
+  int16_t xb = x2, yb = y2;
+  // nothing visible
+  if (PCD8544_ClipLine (&xa, &ya, &xb, &yb) != PCD8544_SUCCESS) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // record line, clipped again when rasterized
+  return PCD8544_ListLine (lcd, x1, x2, y1, y2);
+#else
+  // rasterize into cache
+  return PCD8544_RasterLine (lcd, x1, x2, y1, y2);
+#endif
+}
+
+/**
+ * @desc    Direction of angle as vector scaled 127, y axis up
+ *
+ * @param   int16_t angle - degrees, 0 at 3 o'clock, counterclockwise
+ * @param   int8_t * vector - x, y
+ *
+ * @return  void
+ */
+static void PCD8544_Direction (int16_t angle, int8_t *vector)
+{
+  uint8_t rest;
+  int8_t cosine, sinus;
+
+  // angle to 0 - 359
+  angle %= 360;
+  if (angle < 0) {
+    angle += 360;
+  }
+  // angle within quadrant
+  rest = angle % 90;
+  cosine = pgm_read_byte (&sine[90 - rest]);
+  sinus = pgm_read_byte (&sine[rest]);
+  // rotate by quadrant
+  switch (angle / 90) {
+    case 0:
+      vector[0] = cosine;
+      vector[1] = sinus;
+      break;
+    case 1:
+      vector[0] = -sinus;
+      vector[1] = cosine;
+      break;
+    case 2:
+      vector[0] = -cosine;
+      vector[1] = -sinus;
+      break;
+    default:
+      vector[0] = sinus;
+      vector[1] = -cosine;
+      break;
+  }
+}
+
+/**
+ * @desc    Test if point lies in arc sector by signs of cross products
+ *          with start and end direction - no division, no trigonometry
+ *
+ * @param   const shape_t *
+ * @param   int16_t dx - column offset from center
+ * @param   int16_t dy - row offset from center
+ *
+ * @return  uint8_t - 1 inside
+ */
+static inline uint8_t PCD8544_ShapeArc (const shape_t *shape, int16_t dx, int16_t dy)
+{
+  // start x point (rows grow down, y axis up)
+  int32_t start = (int32_t) shape->arc[0] * -dy - (int32_t) shape->arc[1] * dx;
+  // point x end
+  int32_t end = (int32_t) dx * shape->arc[3] + (int32_t) dy * shape->arc[2];
+
+  // longer than half circle - outside only if between end and start
+  if (shape->wide) {
+    return (start >= 0) || (end >= 0);
+  }
+  // counterclockwise from start and clockwise from end
+  return (start >= 0) && (end >= 0);
+}
+
+/**
+ * @desc    Plot point of circle, ellipse or arc relative to center
+ *
+ * @param   pcd8544_t *
+ * @param   const shape_t *
+ * @param   uint8_t clip - shape crosses display edge
+ * @param   int16_t dx - column offset from center
+ * @param   int16_t dy - row offset from center
+ *
+ * @return  void
+ */
+static void PCD8544_ShapePoint (pcd8544_t *lcd, const shape_t *shape, uint8_t clip, int16_t dx, int16_t dy)
+{
+  int16_t x = shape->x + dx;
+  int16_t y = shape->y + dy;
+  uint8_t bank, bit;
+
+  // outside arc sector
+  if ((shape->kind == SHAPE_ARC) && !PCD8544_ShapeArc (shape, dx, dy)) {
+    return;
+  }
+  // outside display
+  if (clip && (((uint16_t) x >= MAX_NUM_COLS) || ((uint16_t) y >= (MAX_NUM_ROWS * 8)))) {
+    return;
+  }
+  bank = y >> 3;
+  // bank outside raster window
+  if (!RASTER_HAS (bank)) {
+    return;
+  }
+  // apply bit
+  bit = PCD8544_PixelMask (y);
+  PCD8544_ApplyByte (&RASTER_PTR(bank)[x], bit, bit, shape->op);
+  FB_WRITES (1);
+  // mark column as modified
+  PCD8544_MarkDirty (lcd, bank, x, x);
+}
+
+/**
+ * @desc    Plot point mirrored into all octants, points shared by
+ *          octants only once (XOR safe)
+ *
+ * @param   pcd8544_t *
+ * @param   const shape_t *
+ * @param   uint8_t clip - shape crosses display edge
+ * @param   int16_t a - smaller offset
+ * @param   int16_t b - bigger offset
+ *
+ * @return  void
+ */
+static void PCD8544_ShapeOctants (pcd8544_t *lcd, const shape_t *shape, uint8_t clip, int16_t a, int16_t b)
+{
+  // zero radius
+  if (b == 0) {
+    PCD8544_ShapePoint (lcd, shape, clip, 0, 0);
+    return;
+  }
+  // octants near vertical axis
+  PCD8544_ShapePoint (lcd, shape, clip, a, -b);
+  PCD8544_ShapePoint (lcd, shape, clip, a, b);
+  if (a) {
+    PCD8544_ShapePoint (lcd, shape, clip, -a, -b);
+    PCD8544_ShapePoint (lcd, shape, clip, -a, b);
+  }
+  // octants near horizontal axis, diagonal point already plotted
+  if (a != b) {
+    PCD8544_ShapePoint (lcd, shape, clip, b, -a);
+    PCD8544_ShapePoint (lcd, shape, clip, -b, -a);
+    if (a) {
+      PCD8544_ShapePoint (lcd, shape, clip, b, a);
+      PCD8544_ShapePoint (lcd, shape, clip, -b, a);
+    }
+  }
+}
+
+/**
+ * @desc    Apply operation on column span relative to center
+ *
+ * @param   pcd8544_t *
+ * @param   const shape_t *
+ * @param   uint8_t clip - shape crosses display edge
+ * @param   int16_t dx - column offset from center
+ * @param   int16_t top - first row offset from center
+ * @param   int16_t bottom - last row offset from center
+ *
+ * @return  void
+ */
+static void PCD8544_ShapeSpan (pcd8544_t *lcd, const shape_t *shape, uint8_t clip, int16_t dx, int16_t top, int16_t bottom)
+{
+  int16_t x = shape->x + dx;
+  int16_t y0 = shape->y + top;
+  int16_t y1 = shape->y + bottom;
+
+  // clip column
+  if (clip) {
+    // outside display
+    if ((uint16_t) x >= MAX_NUM_COLS) {
+      return;
+    }
+    // clip top / bottom
+    if (y0 < 0) {
+      y0 = 0;
+    }
+    if (y1 >= (MAX_NUM_ROWS * 8)) {
+      y1 = (MAX_NUM_ROWS * 8) - 1;
+    }
+    // nothing visible
+    if (y0 > y1) {
+      return;
+    }
+  }
+  // bank masked column
+  PCD8544_FillArea (lcd, x, x, y0, y1, shape->op);
+}
+
+/**
+ * @desc    Rasterize circle, ellipse or arc
+ *          circles by midpoint algorithm with 8-way symmetry, ellipses
+ *          column by column with midpoint test 4x^2 (2ry + 1)^2 +
+ *          4y^2 (2rx + 1)^2 <= (2rx + 1)^2 (2ry + 1)^2 in 32 bits;
+ *          filled shapes and ellipse outline are vertical spans
+ * @surce   https://en.wikipedia.org/wiki/Midpoint_circle_algorithm
+ *
+ * @param   pcd8544_t *
+ * @param   const shape_t *
+ *
+ * @return  void
+ */
+static void PCD8544_RasterShape (pcd8544_t *lcd, const shape_t *shape)
+{
+  // shape crosses display edge - clip every point
+  uint8_t clip = ((shape->x - shape->rx) < 0) ||
+                 ((shape->x + shape->rx) >= MAX_NUM_COLS) ||
+                 ((shape->y - shape->ry) < 0) ||
+                 ((shape->y + shape->ry) >= (MAX_NUM_ROWS * 8));
+  uint32_t a, b, ab;
+  int16_t x, y, d, lo;
+
+  // circle, filled circle, arc
+  if ((shape->kind != SHAPE_ELLIPSE) && (shape->kind != SHAPE_FILL_ELLIPSE)) {
+    x = 0;
+    y = shape->rx;
+    d = 1 - y;
+    // one octant, x <= y
+    while (x <= y) {
+      // outline
+      if (shape->kind != SHAPE_FILL_CIRCLE) {
+        PCD8544_ShapeOctants (lcd, shape, clip, x, y);
+      // columns +- x, height y
+      } else {
+        PCD8544_ShapeSpan (lcd, shape, clip, x, -y, y);
+        if (x) {
+          PCD8544_ShapeSpan (lcd, shape, clip, -x, -y, y);
+        }
+        // columns +- y, last height x before y steps
+        if ((d >= 0) && (y != x)) {
+          PCD8544_ShapeSpan (lcd, shape, clip, y, -x, x);
+          PCD8544_ShapeSpan (lcd, shape, clip, -y, -x, x);
+        }
+      }
+      // midpoint outside - step diagonally
+      if (d >= 0) {
+        d += 2 * (x - y) + 5;
+        y--;
+      // midpoint inside - step horizontally
+      } else {
+        d += 2 * x + 3;
+      }
+      x++;
+    }
+    return;
+  }
+  // ellipse terms
+  a = (uint32_t) ((shape->rx << 1) + 1) * ((shape->rx << 1) + 1);
+  b = (uint32_t) ((shape->ry << 1) + 1) * ((shape->ry << 1) + 1);
+  ab = a * b;
+  // column 0 is ry high
+  y = shape->ry;
+  for (x = 0; ; x++) {
+    // height of next column, -1 behind last one
+    lo = -1;
+    if (x < shape->rx) {
+      lo = y;
+      while ((lo > 0) &&
+             (((uint32_t) lo * lo * a) > ((ab >> 2) - (uint32_t) (x + 1) * (x + 1) * b))) {
+        lo--;
+      }
+    }
+    // whole column
+    if (shape->kind == SHAPE_FILL_ELLIPSE) {
+      PCD8544_ShapeSpan (lcd, shape, clip, x, -y, y);
+      if (x) {
+        PCD8544_ShapeSpan (lcd, shape, clip, -x, -y, y);
+      }
+    // top and bottom part down / up to next column height
+    } else {
+      d = (lo < y) ? lo + 1 : y;
+      if (d == 0) {
+        PCD8544_ShapeSpan (lcd, shape, clip, x, -y, y);
+        if (x) {
+          PCD8544_ShapeSpan (lcd, shape, clip, -x, -y, y);
+        }
+      } else {
+        PCD8544_ShapeSpan (lcd, shape, clip, x, -y, -d);
+        PCD8544_ShapeSpan (lcd, shape, clip, x, d, y);
+        if (x) {
+          PCD8544_ShapeSpan (lcd, shape, clip, -x, -y, -d);
+          PCD8544_ShapeSpan (lcd, shape, clip, -x, d, y);
+        }
+      }
+    }
+    // last column
+    if (x == shape->rx) {
+      break;
+    }
+    y = lo;
+  }
+}
+
+/**
+ * @desc    Draw circle, ellipse or arc clipped once by bounding box
+ *
+ * @param   pcd8544_t *
+ * @param   const shape_t *
+ *
+ * @return  char
+ */
+static char PCD8544_ShapeDraw (pcd8544_t *lcd, const shape_t *shape)
+{
+  // bounding box outside display
+  if (((shape->x + shape->rx) < 0) ||
+      ((shape->x - shape->rx) >= MAX_NUM_COLS) ||
+      ((shape->y + shape->ry) < 0) ||
+      ((shape->y - shape->ry) >= (MAX_NUM_ROWS * 8))) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+#ifdef PCD8544_BANDED
+  // record shape
+  return PCD8544_ListShape (lcd, shape);
+#else
+  // rasterize into cache
+  PCD8544_RasterShape (lcd, shape);
+  // success return
+  return PCD8544_SUCCESS;
+#endif
+}
+
+/**
+ * @desc    Draw circle or ellipse
+ *
+ * @param   pcd8544_t *
+ * @param   uint8_t kind - SHAPE_CIRCLE / _FILL_CIRCLE / _ELLIPSE / _FILL_ELLIPSE
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t rx - horizontal radius
+ * @param   uint8_t ry - vertical radius
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+static char PCD8544_Shape (pcd8544_t *lcd, uint8_t kind, int16_t x, int16_t y, uint8_t rx, uint8_t ry, uint8_t op)
+{
+  shape_t shape;
+
+  // whole shape
+  memset (&shape, 0x00, sizeof(shape));
+  shape.x = x;
+  shape.y = y;
+  shape.rx = rx;
+  shape.ry = ry;
+  shape.kind = kind;
+  shape.op = op;
+  // clip and draw
+  return PCD8544_ShapeDraw (lcd, &shape);
+}
+
+/**
+ * @desc    Draw circle outline
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t r - radius
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_DrawCircleCtx (pcd8544_t *lcd, int16_t x, int16_t y, uint8_t r, uint8_t op)
+{
+  // 8-way symmetric points
+  return PCD8544_Shape (lcd, SHAPE_CIRCLE, x, y, r, r, op);
+}
+
+/**
+ * @desc    Fill circle
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t r - radius
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_FillCircleCtx (pcd8544_t *lcd, int16_t x, int16_t y, uint8_t r, uint8_t op)
+{
+  // vertical spans
+  return PCD8544_Shape (lcd, SHAPE_FILL_CIRCLE, x, y, r, r, op);
+}
+
+/**
+ * @desc    Draw ellipse outline
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t rx - horizontal radius
+ * @param   uint8_t ry - vertical radius
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_DrawEllipseCtx (pcd8544_t *lcd, int16_t x, int16_t y, uint8_t rx, uint8_t ry, uint8_t op)
+{
+  // midpoint test overflows 32 bits
+  if ((rx > SHAPE_MAX_RADIUS) || (ry > SHAPE_MAX_RADIUS)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // vertical spans between columns
+  return PCD8544_Shape (lcd, SHAPE_ELLIPSE, x, y, rx, ry, op);
+}
+
+/**
+ * @desc    Fill ellipse
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t rx - horizontal radius
+ * @param   uint8_t ry - vertical radius
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_FillEllipseCtx (pcd8544_t *lcd, int16_t x, int16_t y, uint8_t rx, uint8_t ry, uint8_t op)
+{
+  // midpoint test overflows 32 bits
+  if ((rx > SHAPE_MAX_RADIUS) || (ry > SHAPE_MAX_RADIUS)) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // vertical spans
+  return PCD8544_Shape (lcd, SHAPE_FILL_ELLIPSE, x, y, rx, ry, op);
+}
+
+/**
+ * @desc    Draw circular arc counterclockwise from start to end angle
+ *          points of circle are tested against sector once per point
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t r - radius
+ * @param   int16_t start - degrees, 0 at 3 o'clock
+ * @param   int16_t end - degrees
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_DrawArcCtx (pcd8544_t *lcd, int16_t x, int16_t y, uint8_t r, int16_t start, int16_t end, uint8_t op)
+{
+  shape_t shape;
+  int16_t span = end - start;
+
+  // full circle
+  if ((span >= 360) || (span <= -360)) {
+    return PCD8544_Shape (lcd, SHAPE_CIRCLE, x, y, r, r, op);
+  }
+  // counterclockwise span 0 - 359
+  if (span < 0) {
+    span += 360;
+  }
+  // empty arc
+  if (span == 0) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // arc of circle
+  shape.x = x;
+  shape.y = y;
+  shape.rx = r;
+  shape.ry = r;
+  shape.kind = SHAPE_ARC;
+  shape.op = op;
+  // sector
+  PCD8544_Direction (start, &shape.arc[0]);
+  PCD8544_Direction (end, &shape.arc[2]);
+  shape.wide = span > 180;
+  // clip and draw
+  return PCD8544_ShapeDraw (lcd, &shape);
+}
+
+/**
+ * @desc    Vertex of polygon - points may be unaligned in display list
+ *
+ * @param   const uint8_t * points - x, y int16_t pairs
+ * @param   uint8_t index
+ * @param   int16_t * x
+ * @param   int16_t * y
+ *
+ * @return  void
+ */
+static inline void PCD8544_Vertex (const uint8_t *points, uint8_t index, int16_t *x, int16_t *y)
+{
+  memcpy (x, &points[index * 2 * sizeof(int16_t)], sizeof(int16_t));
+  memcpy (y, &points[(index * 2 + 1) * sizeof(int16_t)], sizeof(int16_t));
+}
+
+/**
+ * @desc    Step chain to next edge, 16.16 slope by one division per edge
+ *
+ * @param   edge_t *
+ *
+ * @return  void
+ */
+static void PCD8544_EdgeNext (edge_t *edge)
+{
+  uint16_t next = edge->b + edge->step;
+  int16_t ya, yb;
+
+  // next edge starts at end of current one
+  edge->a = edge->b;
+  if (next >= edge->count) {
+    next -= edge->count;
+  }
+  edge->b = next;
+  PCD8544_Vertex (edge->points, edge->a, &edge->xa, &ya);
+  PCD8544_Vertex (edge->points, edge->b, &edge->xb, &yb);
+  // rows per column
+  edge->slope = 0;
+  if (edge->xb > edge->xa) {
+    edge->slope = ((int32_t) (yb - ya) * 65536) / (edge->xb - edge->xa);
+  }
+  // row at start column
+  edge->y = (int32_t) ya * 65536;
+}
+
+/**
+ * @desc    Start chain from vertex and seek it to column
+ *
+ * @param   edge_t *
+ * @param   const uint8_t * points
+ * @param   uint8_t count - number of vertices
+ * @param   uint8_t first - leftmost vertex
+ * @param   uint8_t last - rightmost vertex
+ * @param   uint8_t step - 1 forward, count - 1 backward
+ * @param   int16_t x - first column
+ *
+ * @return  void
+ */
+static void PCD8544_EdgeStart (edge_t *edge, const uint8_t *points, uint8_t count, uint8_t first, uint8_t last, uint8_t step, int16_t x)
+{
+  int16_t ya, yb;
+  int32_t rows;
+
+  edge->points = points;
+  edge->count = count;
+  edge->step = step;
+  edge->last = last;
+  // edge leaving first vertex
+  edge->b = first;
+  PCD8544_EdgeNext (edge);
+  // skip edges left of column (clipped)
+  while ((edge->a != last) && (edge->xb < x)) {
+    PCD8544_EdgeNext (edge);
+  }
+  // row at column - whole rows and fraction divided separately, so
+  // error of slope is not multiplied by distance of clipped vertex
+  if ((x > edge->xa) && (edge->xb > edge->xa)) {
+    PCD8544_Vertex (points, edge->a, &edge->xa, &ya);
+    PCD8544_Vertex (points, edge->b, &edge->xb, &yb);
+    rows = (int32_t) (yb - ya) * (x - edge->xa);
+    edge->y = (int32_t) (ya + rows / (edge->xb - edge->xa)) * 65536 +
+              (rows % (edge->xb - edge->xa)) * 65536 / (edge->xb - edge->xa);
+  }
+}
+
+/**
+ * @desc    Extend rows lo - hi by chain on column and step it to next one,
+ *          vertices on column (vertical edges) are included exactly
+ *
+ * @param   edge_t *
+ * @param   int16_t x - column
+ * @param   int16_t * lo - first row
+ * @param   int16_t * hi - last row
+ *
+ * @return  void
+ */
+static void PCD8544_EdgeSpan (edge_t *edge, int16_t x, int16_t *lo, int16_t *hi)
+{
+  // rounded row on column
+  int16_t y = (edge->y + 0x8000) >> 16;
+
+  for (;;) {
+    if (y < *lo) {
+      *lo = y;
+    }
+    if (y > *hi) {
+      *hi = y;
+    }
+    // edge continues right of column or chain finished
+    if ((edge->a == edge->last) || (edge->xb > x)) {
+      break;
+    }
+    // edge ends on column
+    PCD8544_EdgeNext (edge);
+    y = edge->y >> 16;
+  }
+  // next column
+  edge->y += edge->slope;
+}
+
+/**
+ * @desc    Rasterize convex polygon by edge walking
+ *          vertices are split at leftmost and rightmost one into two
+ *          chains walked column by column with 16.16 slopes; rows between
+ *          chains are vertical bank-masked spans, equal neighbouring
+ *          columns merged into one area
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t * points - x, y int16_t pairs
+ * @param   uint8_t count - number of vertices
+ * @param   uint8_t op
+ *
+ * @return  void
+ */
+static void PCD8544_RasterPolygon (pcd8544_t *lcd, const uint8_t *points, uint8_t count, uint8_t op)
+{
+  edge_t upper, lower;
+  int16_t x, y, vx, x0, x1;
+  int16_t lo, hi, runLo = 0, runHi = 0, runFrom = -1;
+  uint8_t i, left = 0, right = 0;
+
+  // leftmost and rightmost vertex
+  PCD8544_Vertex (points, 0, &x0, &y);
+  x1 = x0;
+  for (i = 1; i < count; i++) {
+    PCD8544_Vertex (points, i, &vx, &y);
+    if (vx < x0) {
+      x0 = vx;
+      left = i;
+    }
+    if (vx > x1) {
+      x1 = vx;
+      right = i;
+    }
+  }
+  // visible columns
+  if (x0 < 0) {
+    x0 = 0;
+  }
+  if (x1 >= MAX_NUM_COLS) {
+    x1 = MAX_NUM_COLS - 1;
+  }
+  // both chains from left to right vertex
+  PCD8544_EdgeStart (&upper, points, count, left, right, 1, x0);
+  PCD8544_EdgeStart (&lower, points, count, left, right, count - 1, x0);
+  // columns
+  for (x = x0; x <= (x1 + 1); x++) {
+    lo = MAX_NUM_ROWS * 8;
+    hi = -1;
+    if (x <= x1) {
+      // all vertices on single column
+      if (left == right) {
+        for (i = 0; i < count; i++) {
+          PCD8544_Vertex (points, i, &vx, &y);
+          if (y < lo) {
+            lo = y;
+          }
+          if (y > hi) {
+            hi = y;
+          }
+        }
+      }
+      PCD8544_EdgeSpan (&upper, x, &lo, &hi);
+      PCD8544_EdgeSpan (&lower, x, &lo, &hi);
+      // clip rows
+      if (lo < 0) {
+        lo = 0;
+      }
+      if (hi >= (MAX_NUM_ROWS * 8)) {
+        hi = (MAX_NUM_ROWS * 8) - 1;
+      }
+    }
+    // same rows as previous column
+    if ((runFrom >= 0) && (lo == runLo) && (hi == runHi)) {
+      continue;
+    }
+    // flush run of equal columns
+    if (runFrom >= 0) {
+      PCD8544_FillArea (lcd, runFrom, x - 1, runLo, runHi, op);
+    }
+    // start new run, nothing if column empty
+    runFrom = (lo <= hi) ? x : -1;
+    runLo = lo;
+    runHi = hi;
+  }
+}
+
+/**
+ * @desc    Fill convex polygon
+ *
+ * @param   pcd8544_t *
+ * @param   const int16_t * points - x, y pairs in order along outline
+ * @param   uint8_t count - number of vertices
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_FillPolygonCtx (pcd8544_t *lcd, const int16_t *points, uint8_t count, uint8_t op)
+{
+  int16_t x0, x1, y0, y1;
+  uint8_t i;
+
+  // no vertex
+  if (!count) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+  // bounding box
+  x0 = x1 = points[0];
+  y0 = y1 = points[1];
+  for (i = 0; i < (count << 1); i += 2) {
+    // slopes overflow 32 bits
+    if ((points[i] < -POLYGON_MAX_COORD) || (points[i] > POLYGON_MAX_COORD) ||
+        (points[i + 1] < -POLYGON_MAX_COORD) || (points[i + 1] > POLYGON_MAX_COORD)) {
+      // out of range
+      return PCD8544_ERROR;
+    }
+    if (points[i] < x0) {
+      x0 = points[i];
+    } else if (points[i] > x1) {
+      x1 = points[i];
+    }
+    if (points[i + 1] < y0) {
+      y0 = points[i + 1];
+    } else if (points[i + 1] > y1) {
+      y1 = points[i + 1];
+    }
+  }
+  // bounding box outside display
+  if ((x1 < 0) || (x0 >= MAX_NUM_COLS) || (y1 < 0) || (y0 >= (MAX_NUM_ROWS * 8))) {
+    // out of range
+    return PCD8544_ERROR;
+  }
+#ifdef PCD8544_BANDED
+  // record polygon
+  return PCD8544_ListPolygon (lcd, points, count, op);
+#else
+  // rasterize into cache
+  PCD8544_RasterPolygon (lcd, (const uint8_t *) points, count, op);
+  // success return
+  return PCD8544_SUCCESS;
+#endif
+}
+
+/**
+ * @desc    Fill triangle
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x0, y0 - first vertex
+ * @param   int16_t x1, y1 - second vertex
+ * @param   int16_t x2, y2 - third vertex
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_FillTriangleCtx (pcd8544_t *lcd, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t op)
+{
+  int16_t points[6];
+
+  // vertices
+  points[0] = x0;
+  points[1] = y0;
+  points[2] = x1;
+  points[3] = y1;
+  points[4] = x2;
+  points[5] = y2;
+  // triangle is convex polygon
+  return PCD8544_FillPolygonCtx (lcd, points, 3, op);
+}
+
+#ifdef PCD8544_ASYNC
+
+/**
+ * @desc    Fill rectangle with gray level
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   int16_t h - height
+ * @param   uint8_t level - PCD8544_GRAY_WHITE / _LIGHT / _DARK / _BLACK
+ *
+ * @return  char
+ */
+char PCD8544_GrayFillRectCtx (pcd8544_t *lcd, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t level)
+{
+  uint8_t *cache = lcd->cache;
+  char status;
+  // no plane of weight 1
+  if (!lcd->gray) {
+    // error return
+    return PCD8544_ERROR;
+  }
+  // plane of weight 2
+  status = PCD8544_ClipFill (lcd, x, y, w, h, (level & 0x02) ? PCD8544_OP_SET : PCD8544_OP_CLR);
+  // plane of weight 1 drawn through cache pointer
+  lcd->cache = lcd->gray;
+  PCD8544_ClipFill (lcd, x, y, w, h, (level & 0x01) ? PCD8544_OP_SET : PCD8544_OP_CLR);
+  lcd->cache = cache;
+  // status of clipping
+  return status;
+}
+
+/**
+ * @desc    Draw pixel with gray level
+ *
+ * @param   pcd8544_t *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   uint8_t level - PCD8544_GRAY_WHITE / _LIGHT / _DARK / _BLACK
+ *
+ * @return  char
+ */
+char PCD8544_GrayPixelCtx (pcd8544_t *lcd, int16_t x, int16_t y, uint8_t level)
+{
+  // rectangle 1 x 1
+  return PCD8544_GrayFillRectCtx (lcd, x, y, 1, 1, level);
+}
+
+/**
+ * @desc    Draw gray bitmap on x, y position
+ *          two planes in native vertical-byte format, plane of weight 2
+ *          followed by plane of weight 1, ceil(h/8) banks of w bytes each
+ *
+ * @param   pcd8544_t *
+ * @param   const uint8_t * bitmap - PROGMEM
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   uint8_t w - width
+ * @param   uint8_t h - height
+ *
+ * @return  char
+ */
+char PCD8544_GrayDrawBitmapCtx (pcd8544_t *lcd, const uint8_t *bitmap, int16_t x, int16_t y, uint8_t w, uint8_t h)
+{
+  uint8_t *cache = lcd->cache;
+  char status;
+  // no plane of weight 1
+  if (!lcd->gray) {
+    // error return
+    return PCD8544_ERROR;
+  }
+  // plane of weight 2
+  status = PCD8544_Blit (lcd, bitmap, 0, x, y, w, h, PCD8544_OP_COPY);
+  // plane of weight 1 drawn through cache pointer
+  lcd->cache = lcd->gray;
+  PCD8544_Blit (lcd, bitmap + ((h + 7) >> 3) * w, 0, x, y, w, h, PCD8544_OP_COPY);
+  lcd->cache = cache;
+  // status of clipping
+  return status;
+}
+
+#endif
+
+#ifdef PCD8544_BANDED
+
+/**
+ * @desc    Rasterize display list into bank held in strip memory
+ *
+ * @param   pcd8544_t *
+ *
+ * @return  void
+ */
+static void PCD8544_ListReplay (pcd8544_t *lcd)
+{
+  uint16_t i = 0;
+  uint8_t *record;
+  const uint8_t *bitmap, *mask;
+  const pcd8544_font_t *font;
+  const pcd8544_chart_t *chart;
+  const pcd8544_sprite_t *sprite;
+  shape_t shape;
+  glyph_t glyph;
+  int16_t x, y;
+  uint8_t n, col;
+
+  // loop through records
+  while (i < lcd->listLen) {
+    record = &lcd->list[i];
+    switch (record[0]) {
+      // pixel
+      case DLIST_PIXEL:
+        PCD8544_RasterPixel (lcd, record[1], record[2]);
+        i += 3;
+        break;
+      // line
+      case DLIST_LINE:
+        PCD8544_RasterLine (lcd, record[1], record[2], record[3], record[4]);
+        i += 5;
+        break;
+      // area operation
+      case DLIST_FILL:
+        PCD8544_FillArea (lcd, record[1], record[2], record[3], record[4], record[5]);
+        i += 6;
+        break;
+      // bitmap
+      case DLIST_BLIT:
+        record++;
+        memcpy (&bitmap, record, sizeof(bitmap));
+        record += sizeof(bitmap);
+        memcpy (&mask, record, sizeof(mask));
+        record += sizeof(mask);
+        memcpy (&x, record, sizeof(x));
+        record += sizeof(x);
+        memcpy (&y, record, sizeof(y));
+        record += sizeof(y);
+        PCD8544_Blit (lcd, bitmap, mask, x, y, record[0], record[1], record[2]);
+        i += DLIST_BLIT_SIZE;
+        break;
+      // sprite layer on current positions
+      case DLIST_SPRITES:
+        memcpy (&sprite, &record[2], sizeof(sprite));
+        for (n = 0; n < record[1]; n++, sprite++) {
+          if (sprite->visible) {
+            PCD8544_Blit (lcd, sprite->bitmap, sprite->mask, sprite->x, sprite->y, sprite->w, sprite->h, PCD8544_OP_COPY);
+          }
+        }
+        i += DLIST_SPRITES_SIZE;
+        break;
+      // strip chart
+      case DLIST_CHART:
+        memcpy (&chart, &record[1], sizeof(chart));
+        PCD8544_ChartRaster (lcd, chart);
+        i += DLIST_CHART_SIZE;
+        break;
+      // circle, ellipse, arc
+      case DLIST_SHAPE:
+        memcpy (&shape, &record[1], sizeof(shape));
+        PCD8544_RasterShape (lcd, &shape);
+        i += DLIST_SHAPE_SIZE;
+        break;
+      // convex polygon
+      case DLIST_POLYGON:
+        PCD8544_RasterPolygon (lcd, &record[DLIST_POLYGON_SIZE], record[2], record[1]);
+        i += DLIST_POLYGON_SIZE + record[2] * 2 * sizeof(int16_t);
+        break;
+      // text
+      default:
+        memcpy (&font, &record[5], sizeof(font));
+        col = record[1];
+        for (n = 0; n < record[3]; n++) {
+          // only stored glyphs are recorded
+          if (PCD8544_GlyphAt (font, record[DLIST_TEXT_SIZE + n], &glyph) != PCD8544_SUCCESS) {
+            continue;
+          }
+          PCD8544_Blit (lcd, glyph.bitmap, 0, col, record[2], glyph.width, glyph.height, PCD8544_OP_COPY);
+          col += glyph.advance;
+        }
+        i += DLIST_TEXT_SIZE + record[3];
+        break;
+    }
+  }
+}
+
+#endif
+
+/**
+ * @desc    Initialise pcd8544 controller
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void PCD8544_Init (void)
+{
+  // default display
+  PCD8544_InitCtx (&pcd8544Default);
+}
+
+/**
+ * @desc    Command send
+ *
+ * @param   char
+ *
+ * @return  void
+ */
+void PCD8544_CommandSend (char data)
+{
+  // default display
+  PCD8544_CommandSendCtx (&pcd8544Default, data);
+}
+
+/**
+ * @desc    Data send
+ *
+ * @param   char
+ *
+ * @return  void
+ */
+void PCD8544_DataSend (char data)
+{
+  // default display
+  PCD8544_DataSendCtx (&pcd8544Default, data);
+}
+
+/**
+ * @desc    Command buffer send - CE asserted once for whole buffer
+ *
+ * @param   const uint8_t *
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+void PCD8544_CommandSendBuffer (const uint8_t *data, uint8_t len)
+{
+  // default display
+  PCD8544_CommandSendBufferCtx (&pcd8544Default, data, len);
+}
+
+/**
+ * @desc    Command buffer send from flash - CE asserted once for whole buffer
+ *
+ * @param   const uint8_t * - PROGMEM
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+void PCD8544_CommandSendBuffer_P (const uint8_t *data, uint8_t len)
+{
+  // default display
+  PCD8544_CommandSendBufferCtx_P (&pcd8544Default, data, len);
+}
+
+/**
+ * @desc    Data buffer send - CE asserted once for whole buffer
+ *
+ * @param   const uint8_t *
+ * @param   uint16_t
+ *
+ * @return  void
+ */
+void PCD8544_DataSendBuffer (const uint8_t *data, uint16_t len)
+{
+  // default display
+  PCD8544_DataSendBufferCtx (&pcd8544Default, data, len);
+}
+
+/**
+ * @desc    Data buffer send from flash - CE asserted once for whole buffer
+ *
+ * @param   const uint8_t * - PROGMEM
+ * @param   uint16_t
+ *
+ * @return  void
+ */
+void PCD8544_DataSendBuffer_P (const uint8_t *data, uint16_t len)
+{
+  // default display
+  PCD8544_DataSendBufferCtx_P (&pcd8544Default, data, len);
+}
+
+/**
+ * @desc    Set display mode - command sent only if mode differs
+ *
+ * @param   uint8_t - DISPLAY_BLANK / NORMAL_MODE / ALL_SEGMS_ON / INVERSE_MODE
+ *
+ * @return  void
+ */
+void PCD8544_SetDisplayMode (uint8_t mode)
+{
+  // default display
+  PCD8544_SetDisplayModeCtx (&pcd8544Default, mode);
+}
+
+/**
+ * @desc    Reset Impulse
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void PCD8544_ResetImpulse (void)
+{
+  // default display
+  PCD8544_ResetImpulseCtx (&pcd8544Default);
+}
+
+/**
+ * @desc    Clear screen
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void PCD8544_ClearScreen (void)
+{
+  // default display
+  PCD8544_ClearScreenCtx (&pcd8544Default);
+}
+
+/**
+ * @desc    Update screen
+ *          sends only modified column spans of banks, vertically
+ *          addressed columns of tall and narrow region or full frame,
+ *          whichever needs least bytes
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void PCD8544_UpdateScreen (void)
+{
+  // default display
+  PCD8544_UpdateScreenCtx (&pcd8544Default);
+}
+
+/**
+ * @desc    Update screen asynchronously
+ *          first byte is sent immediately, rest is fed from SPI_STC_vect
+ *          (global interrupts must be enabled). Modified spans are taken
+ *          over and marked clean at start, so drawing into cache during
+ *          transfer is allowed: bytes not yet sent carry new content and
+ *          every write is marked dirty again, i.e. it is guaranteed
+ *          on display after next update.
+ *
+ * @param   void
+ *
+ * @return  char - PCD8544_ERROR if transfer still in progress
+ */
+char PCD8544_UpdateScreenAsync (void)
+{
+  // default display
+  return PCD8544_UpdateScreenAsyncCtx (&pcd8544Default);
+}
+
+/**
+ * @desc    Draw bitmap on x, y position (any pixel)
+ *
+ * @param   const uint8_t * bitmap - PROGMEM, ceil(h/8) banks of w bytes,
+ *                                   bit 0 top row (same as FONTS)
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   uint8_t w - width
+ * @param   uint8_t h - height
+ * @param   uint8_t op - PCD8544_OP_SET (OR) / _CLR / _XOR / _AND / _COPY
+ *
+ * @return  char
+ */
+char PCD8544_DrawBitmap (const uint8_t *bitmap, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t op)
+{
+  // default display
+  return PCD8544_DrawBitmapCtx (&pcd8544Default, bitmap, x, y, w, h, op);
+}
+
+/**
+ * @desc    Draw bitmap with transparency mask on x, y position
+ *          pixels outside mask keep background
+ *
+ * @param   const uint8_t * bitmap - PROGMEM
+ * @param   const uint8_t * mask - PROGMEM, same layout as bitmap
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   uint8_t w - width
+ * @param   uint8_t h - height
+ *
+ * @return  char
+ */
+char PCD8544_DrawBitmapMasked (const uint8_t *bitmap, const uint8_t *mask, int16_t x, int16_t y, uint8_t w, uint8_t h)
+{
+  // default display
+  return PCD8544_DrawBitmapMaskedCtx (&pcd8544Default, bitmap, mask, x, y, w, h);
+}
+
+/**
+ * @desc    Draw sprite layer
+ *
+ * @param   pcd8544_sprite_t * - sprites, first is bottom
+ * @param   uint8_t count
+ *
+ * @return  char
+ */
+char PCD8544_DrawSprites (pcd8544_sprite_t *sprites, uint8_t count)
+{
+  // default display
+  return PCD8544_DrawSpritesCtx (&pcd8544Default, sprites, count);
+}
+
+/**
+ * @desc    Draw character on text cursor (any pixel position)
+ *
+ * @param   char
+ *
+ * @return  char
+ */
+char PCD8544_DrawChar (char character)
+{
+  // default display
+  return PCD8544_DrawCharCtx (&pcd8544Default, character);
+}
+
+/**
+ * @desc    Draw code point (Unicode BMP) on text cursor (any pixel position)
+ *
+ * @param   uint16_t
+ *
+ * @return  char
+ */
+char PCD8544_DrawCode (uint16_t code)
+{
+  // default display
+  return PCD8544_DrawCodeCtx (&pcd8544Default, code);
+}
+
+/**
+ * @desc    Draw string (UTF-8)
+ *
+ * @param   char *
+ *
+ * @return  char
+ */
+void PCD8544_DrawString (char *str)
+{
+  // default display
+  PCD8544_DrawStringCtx (&pcd8544Default, str);
+}
+
+/**
+ * @desc    Set text position x, y (cache only, no SPI traffic)
+ *
+ * @param   char x - position 0 <= x <=  5
+ * @param   char y - position 0 <= y <= 14
+ *
+ * @return  char
+ */
+char PCD8544_SetTextPosition (char x, char y)
+{
+  // default display
+  return PCD8544_SetTextPositionCtx (&pcd8544Default, x, y);
+}
+
+/**
+ * @desc    Set text font
+ *
+ * @param   const pcd8544_font_t * font - PROGMEM, NULL built-in 5x7
+ *
+ * @return  void
+ */
+void PCD8544_SetFont (const pcd8544_font_t *font)
+{
+  // default display
+  PCD8544_SetFontCtx (&pcd8544Default, font);
+}
+
+/**
+ * @desc    Width of UTF-8 string in current font (without trailing spacing)
+ *
+ * @param   const char *
+ *
+ * @return  uint16_t - pixels
+ */
+uint16_t PCD8544_StringWidth (const char *str)
+{
+  // default display
+  return PCD8544_StringWidthCtx (&pcd8544Default, str);
+}
+
+/**
+ * @desc    Set pixel position x, y (cache only, no SPI traffic)
+ *
+ * @param   char x - position 0 <= x <= 47
+ * @param   char y - position 0 <= y <= 83
+ *
+ * @return  char
+ */
+char PCD8544_SetPixelPosition (char x, char y)
+{
+  // default display
+  return PCD8544_SetPixelPositionCtx (&pcd8544Default, x, y);
+}
+
+/**
+ * @desc    Draw pixel on position x, y
+ *
+ * @param   char x - position
+ * @param   char y - position
+ *
+ * @return  char
+ */
+char PCD8544_DrawPixel (char x, char y)
+{
+  // default display
+  return PCD8544_DrawPixelCtx (&pcd8544Default, x, y);
+}
+
+/**
+ * @desc    Draw horizontal line
+ *
+ * @param   int16_t x - start column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+ *
+ * @return  char
+ */
+char PCD8544_DrawHLine (int16_t x, int16_t y, int16_t w, uint8_t op)
+{
+  // default display
+  return PCD8544_DrawHLineCtx (&pcd8544Default, x, y, w, op);
+}
+
+/**
+ * @desc    Draw vertical line
+ *
+ * @param   int16_t x - column
+ * @param   int16_t y - start row
+ * @param   int16_t h - height
+ * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+ *
+ * @return  char
+ */
+char PCD8544_DrawVLine (int16_t x, int16_t y, int16_t h, uint8_t op)
+{
+  // default display
+  return PCD8544_DrawVLineCtx (&pcd8544Default, x, y, h, op);
+}
+
+/**
+ * @desc    Draw rectangle outline
+ *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   int16_t h - height
+ * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+ *
+ * @return  char
+ */
+char PCD8544_DrawRect (int16_t x, int16_t y, int16_t w, int16_t h, uint8_t op)
+{
+  // default display
+  return PCD8544_DrawRectCtx (&pcd8544Default, x, y, w, h, op);
+}
+
+/**
+ * @desc    Fill rectangle
+ *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   int16_t h - height
+ * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+ *
+ * @return  char
+ */
+char PCD8544_FillRect (int16_t x, int16_t y, int16_t w, int16_t h, uint8_t op)
+{
+  // default display
+  return PCD8544_FillRectCtx (&pcd8544Default, x, y, w, h, op);
+}
+
+#ifndef PCD8544_BANDED
+
+/**
+ * @desc    Scroll region vertically by pixels, vacated rows cleared
+ *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   int16_t h - height
+ * @param   int8_t dy - rows, negative up, positive down
+ *
+ * @return  char
+ */
+char PCD8544_ScrollRegion (int16_t x, int16_t y, int16_t w, int16_t h, int8_t dy)
+{
+  // default display
+  return PCD8544_ScrollRegionCtx (&pcd8544Default, x, y, w, h, dy);
+}
+
+#endif
+
+/**
+ * @desc    Draw integer into field
+ *
+ * @param   pcd8544_field_t *
+ * @param   int32_t value
+ *
+ * @return  char
+ */
+char PCD8544_DrawInt (pcd8544_field_t *field, int32_t value)
+{
+  // default display
+  return PCD8544_DrawIntCtx (&pcd8544Default, field, value);
+}
+
+/**
+ * @desc    Draw fixed-point number into field
+ *
+ * @param   pcd8544_field_t *
+ * @param   int32_t value - number * 10^decimals
+ * @param   uint8_t decimals
+ *
+ * @return  char
+ */
+char PCD8544_DrawFixed (pcd8544_field_t *field, int32_t value, uint8_t decimals)
+{
+  // default display
+  return PCD8544_DrawFixedCtx (&pcd8544Default, field, value, decimals);
+}
+
+/**
+ * @desc    Render changed or moved console rows and send them
+ *
+ * @param   pcd8544_console_t *
+ *
+ * @return  void
+ */
+void PCD8544_ConsoleFlush (pcd8544_console_t *console)
+{
+  // default display
+  PCD8544_ConsoleFlushCtx (&pcd8544Default, console);
+}
+
+/**
+ * @desc    Draw strip chart
+ *
+ * @param   pcd8544_chart_t *
+ *
+ * @return  char
+ */
+char PCD8544_DrawChart (pcd8544_chart_t *chart)
+{
+  // default display
+  return PCD8544_DrawChartCtx (&pcd8544Default, chart);
+}
+
+/**
+ * @desc    Draw line
+ *
+ * @param   char x - start x position
+ * @param   char y - end x position
+ * @param   char x - start y position
+ * @param   char y - end y position
+ *
+ * @return  char
+ */
+char PCD8544_DrawLine (char x1, char x2, char y1, char y2)
+{
+  // default display
+  return PCD8544_DrawLineCtx (&pcd8544Default, x1, x2, y1, y2);
+}
+
+/**
+ * @desc    Draw circle outline
+ *
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t r - radius
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_DrawCircle (int16_t x, int16_t y, uint8_t r, uint8_t op)
+{
+  // default display
+  return PCD8544_DrawCircleCtx (&pcd8544Default, x, y, r, op);
+}
+
+/**
+ * @desc    Fill circle
+ *
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t r - radius
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_FillCircle (int16_t x, int16_t y, uint8_t r, uint8_t op)
+{
+  // default display
+  return PCD8544_FillCircleCtx (&pcd8544Default, x, y, r, op);
+}
+
+/**
+ * @desc    Draw ellipse outline
+ *
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t rx - horizontal radius
+ * @param   uint8_t ry - vertical radius
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_DrawEllipse (int16_t x, int16_t y, uint8_t rx, uint8_t ry, uint8_t op)
+{
+  // default display
+  return PCD8544_DrawEllipseCtx (&pcd8544Default, x, y, rx, ry, op);
+}
+
+/**
+ * @desc    Fill ellipse
+ *
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t rx - horizontal radius
+ * @param   uint8_t ry - vertical radius
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_FillEllipse (int16_t x, int16_t y, uint8_t rx, uint8_t ry, uint8_t op)
+{
+  // default display
+  return PCD8544_FillEllipseCtx (&pcd8544Default, x, y, rx, ry, op);
+}
+
+/**
+ * @desc    Draw circular arc counterclockwise from start to end angle
+ *
+ * @param   int16_t x - center column
+ * @param   int16_t y - center row
+ * @param   uint8_t r - radius
+ * @param   int16_t start - degrees, 0 at 3 o'clock
+ * @param   int16_t end - degrees
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_DrawArc (int16_t x, int16_t y, uint8_t r, int16_t start, int16_t end, uint8_t op)
+{
+  // default display
+  return PCD8544_DrawArcCtx (&pcd8544Default, x, y, r, start, end, op);
+}
+
+/**
+ * @desc    Fill triangle
+ *
+ * @param   int16_t x0, y0 - first vertex
+ * @param   int16_t x1, y1 - second vertex
+ * @param   int16_t x2, y2 - third vertex
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_FillTriangle (int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t op)
+{
+  // default display
+  return PCD8544_FillTriangleCtx (&pcd8544Default, x0, y0, x1, y1, x2, y2, op);
+}
+
+/**
+ * @desc    Fill convex polygon
+ *
+ * @param   const int16_t * points - x, y pairs in order along outline
+ * @param   uint8_t count - number of vertices
+ * @param   uint8_t op
+ *
+ * @return  char
+ */
+char PCD8544_FillPolygon (const int16_t *points, uint8_t count, uint8_t op)
+{
+  // default display
+  return PCD8544_FillPolygonCtx (&pcd8544Default, points, count, op);
+}
+
+/**
+ * @desc    Draw RLE compressed image (PROGMEM) on bank aligned region
+ *
+ * @param   const uint8_t * image - PROGMEM, PCD8544 RLE of banks x w bytes
+ * @param   uint8_t x - first column
+ * @param   uint8_t bank - first bank
+ * @param   uint8_t w - width
+ * @param   uint8_t banks - height in banks
+ * @param   uint8_t flags - PCD8544_IMAGE_CACHE
+ *
+ * @return  char
+ */
+char PCD8544_DrawImageRle (const uint8_t *image, uint8_t x, uint8_t bank, uint8_t w, uint8_t banks, uint8_t flags)
+{
+  // default display
+  return PCD8544_DrawImageRleCtx (&pcd8544Default, image, x, bank, w, banks, flags);
+}
+
+#ifdef PCD8544_ASYNC
+
+/**
+ * @desc    Start grayscale engine on default display
+ *
+ * @param   uint8_t * - plane of weight 1, CACHE_SIZE_MEM bytes
+ *
+ * @return  char
+ */
+char PCD8544_GrayStart (uint8_t *plane)
+{
+  // default display
+  return PCD8544_GrayStartCtx (&pcd8544Default, plane);
+}
+
+/**
+ * @desc    Fill rectangle with gray level
+ *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   int16_t w - width
+ * @param   int16_t h - height
+ * @param   uint8_t level - PCD8544_GRAY_WHITE / _LIGHT / _DARK / _BLACK
+ *
+ * @return  char
+ */
+char PCD8544_GrayFillRect (int16_t x, int16_t y, int16_t w, int16_t h, uint8_t level)
+{
+  // default display
+  return PCD8544_GrayFillRectCtx (&pcd8544Default, x, y, w, h, level);
+}
+
+/**
+ * @desc    Draw pixel with gray level
+ *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   uint8_t level - PCD8544_GRAY_WHITE / _LIGHT / _DARK / _BLACK
+ *
+ * @return  char
+ */
+char PCD8544_GrayPixel (int16_t x, int16_t y, uint8_t level)
+{
+  // default display
+  return PCD8544_GrayPixelCtx (&pcd8544Default, x, y, level);
+}
+
+/**
+ * @desc    Draw gray bitmap - plane of weight 2 followed by plane of weight 1
+ *
+ * @param   const uint8_t * bitmap - PROGMEM, 2 x ceil(h/8) banks of w bytes
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   uint8_t w - width
+ * @param   uint8_t h - height
+ *
+ * @return  char
+ */
+char PCD8544_GrayDrawBitmap (const uint8_t *bitmap, int16_t x, int16_t y, uint8_t w, uint8_t h)
+{
+  // default display
+  return PCD8544_GrayDrawBitmapCtx (&pcd8544Default, bitmap, x, y, w, h);
+}
+
+#endif
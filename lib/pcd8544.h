@@ -20,6 +20,9 @@
 #ifndef __PCD8544_H__
 #define __PCD8544_H__
 
+  #include <avr/io.h>
+  #include "font.h"
+
   // define port
   #ifndef PORT
     #define PORT            PORTB
@@ -119,6 +122,144 @@
   #define BIAS_1_16         0x06
   #define BIAS_1_8          0x07
 
+  // Asynchronous transfer states
+  // -----------------------------------
+  #define ASYNC_STATE_Y_ADDR      0
+  #define ASYNC_STATE_X_ADDR      1
+  #define ASYNC_STATE_DATA        2
+  #define ASYNC_STATE_VERTI_DATA  3
+  #define ASYNC_STATE_END         4
+
+  // Drawing operations
+  // -----------------------------------
+  #define PCD8544_OP_SET    0
+  #define PCD8544_OP_CLR    1
+  #define PCD8544_OP_XOR    2
+  #define PCD8544_OP_COPY   3
+  #define PCD8544_OP_AND    4
+
+  // Text
+  // -----------------------------------
+  // code point of invalid UTF-8 sequence (replacement character)
+  #define PCD8544_UTF8_INVALID  0xFFFD
+
+  // Number fields
+  // -----------------------------------
+  // maximum cells of field - sign, 10 digits, decimal point
+  #define PCD8544_FIELD_CELLS   12
+  // right aligned, space padded (default)
+  #define PCD8544_FIELD_RIGHT   0x00
+  // left aligned, space padded
+  #define PCD8544_FIELD_LEFT    0x01
+  // right aligned, zero padded after sign
+  #define PCD8544_FIELD_ZERO    0x02
+
+  // Console (built-in 5x7 font, row per bank)
+  // -----------------------------------
+  #define PCD8544_CONSOLE_ROWS  MAX_NUM_ROWS
+  #define PCD8544_CONSOLE_COLS  (MAX_NUM_COLS / (CHARS_COLS_LENGTH + 1))
+  // tab stop every 4 columns
+  #define PCD8544_CONSOLE_TAB   4
+  // control character - clear from cursor to end of row (VT)
+  #define PCD8544_CONSOLE_EOL   '\v'
+  // control character - clear console, cursor home (FF)
+  #define PCD8544_CONSOLE_CLS   '\f'
+
+  // Sprites
+  // -----------------------------------
+  // background save buffer of sprite w x h - banks on any row + 1
+  #define PCD8544_SPRITE_SAVE(w, h)   ((w) * ((((h) + 7) >> 3) + 1))
+
+  // Strip chart flags
+  // -----------------------------------
+  // sample as single pixel
+  #define PCD8544_CHART_DOTS    0x00
+  // sample connected to previous one by vertical segment
+  #define PCD8544_CHART_LINE    0x01
+
+  // Shape kinds (circle, ellipse, arc)
+  // -----------------------------------
+  #define SHAPE_CIRCLE          0x00
+  #define SHAPE_FILL_CIRCLE     0x01
+  #define SHAPE_ELLIPSE         0x02
+  #define SHAPE_FILL_ELLIPSE    0x03
+  #define SHAPE_ARC             0x04
+  // largest ellipse radius - A * B of midpoint test fits 32 bits
+  #define SHAPE_MAX_RADIUS      127
+
+  // Polygon fill
+  // -----------------------------------
+  // largest vertex coordinate magnitude - 16.16 edge slopes fit 32 bits
+  #define POLYGON_MAX_COORD     8191
+
+  // Image streaming flags
+  // -----------------------------------
+  // write decoded bytes into cache too
+  #define PCD8544_IMAGE_CACHE   0x01
+
+  // Line clipping region codes
+  // -----------------------------------
+  #define CLIP_INSIDE       0x00
+  #define CLIP_LEFT         0x01
+  #define CLIP_RIGHT        0x02
+  #define CLIP_TOP          0x04
+  #define CLIP_BOTTOM       0x08
+
+  // Banded rendering (define PCD8544_BANDED)
+  // -----------------------------------
+  // drawing calls are recorded into display list and rasterized one bank
+  // at a time into 84 bytes strip on update, instead of 504 bytes cache
+  // list full - call is not recorded (not drawn) and returns PCD8544_ERROR,
+  // strings stop at first glyph that does not fit; records stored
+  // before are kept until PCD8544_ClearScreen, so size the list for the
+  // largest frame (AVR: pixel 3 bytes, line 5, fill 6, text 7 + 1 per
+  // glyph, blit 12)
+  #ifndef PCD8544_DLIST_SIZE
+    #define PCD8544_DLIST_SIZE  160
+  #endif
+  // display list records
+  #define DLIST_PIXEL       0x01
+  #define DLIST_LINE        0x02
+  #define DLIST_FILL        0x03
+  #define DLIST_BLIT        0x04
+  #define DLIST_TEXT        0x05
+  #define DLIST_CHART       0x06
+  #define DLIST_SPRITES     0x07
+  #define DLIST_SHAPE       0x08
+  #define DLIST_POLYGON     0x09
+
+  // Grayscale (temporal dither)
+  // -----------------------------------
+  // cache is plane of weight 2, second plane of weight 1, pixel is dark
+  // in 0 - 3 of PCD8544_GRAY_FRAMES frames
+  #define PCD8544_GRAY_WHITE      0
+  #define PCD8544_GRAY_LIGHT      1
+  #define PCD8544_GRAY_DARK       2
+  #define PCD8544_GRAY_BLACK      3
+  #define PCD8544_GRAY_FRAMES     3
+  // frames per second, gray cycle is PCD8544_GRAY_HZ / PCD8544_GRAY_FRAMES
+  #ifndef PCD8544_GRAY_HZ
+    #define PCD8544_GRAY_HZ       150
+  #endif
+  // define PCD8544_GRAY_TIMER1 - frames paced by Timer 1 compare match A,
+  // otherwise PCD8544_GrayTick has to be called from own timer interrupt
+  #ifdef PCD8544_GRAY_TIMER1
+    #ifndef F_CPU
+      #error "PCD8544_GRAY_TIMER1 needs F_CPU"
+    #endif
+    // CTC top, prescaler 8
+    #define GRAY_TIMER1_TOP       ((F_CPU / 8 / PCD8544_GRAY_HZ) - 1)
+    #if GRAY_TIMER1_TOP > 0xFFFF
+      #error "PCD8544_GRAY_HZ too low for Timer 1 with prescaler 8"
+    #endif
+    // timer interrupt mask register
+    #ifdef TIMSK1
+      #define GRAY_TIMSK          TIMSK1
+    #else
+      #define GRAY_TIMSK          TIMSK
+    #endif
+  #endif
+
   // AREA definition
   // -----------------------------------
   #define MAX_NUM_ROWS      6
@@ -138,6 +279,363 @@
   // wait until bit is set
   #define WAIT_UNTIL_BIT_IS_SET(port, bit)  { while (IS_BIT_CLR(port, bit)); }
 
+  // Transport (define PCD8544_TRANSPORT)
+  // -----------------------------------
+  // PCD8544_TRANSPORT_HWSPI   - hardware SPI, SCK / DIN on SPI pins,
+  //                             serial clock fclk / PCD8544_SPI_DIV
+  // PCD8544_TRANSPORT_BITBANG - unrolled bit-bang on any pins PCD8544_BB_SCK,
+  //                             PCD8544_BB_DIN of PCD8544_BB_PORT
+  // PCD8544_TRANSPORT_CAPTURE - bytes handed to PCD8544_CAPTURE (data),
+  //                             emulated controller in host build
+  #define PCD8544_TRANSPORT_HWSPI           1
+  #define PCD8544_TRANSPORT_BITBANG         2
+  #define PCD8544_TRANSPORT_CAPTURE         3
+  #ifndef PCD8544_TRANSPORT
+    #ifdef PCD8544_HOST
+      #define PCD8544_TRANSPORT             PCD8544_TRANSPORT_CAPTURE
+    #else
+      #define PCD8544_TRANSPORT             PCD8544_TRANSPORT_HWSPI
+    #endif
+  #endif
+
+  #if PCD8544_TRANSPORT == PCD8544_TRANSPORT_HWSPI
+    // SPI clock prescaler 2, 4, 8, 16, 32, 64, 128
+    #ifndef PCD8544_SPI_DIV
+      #define PCD8544_SPI_DIV               16
+    #endif
+    // SPR1, SPR0 in SPCR / SPI2X in SPSR
+    #if PCD8544_SPI_DIV == 2
+      #define SPI_CLOCK_SPCR                0
+      #define SPI_CLOCK_SPSR                (1 << SPI2X)
+    #elif PCD8544_SPI_DIV == 4
+      #define SPI_CLOCK_SPCR                0
+      #define SPI_CLOCK_SPSR                0
+    #elif PCD8544_SPI_DIV == 8
+      #define SPI_CLOCK_SPCR                (1 << SPR0)
+      #define SPI_CLOCK_SPSR                (1 << SPI2X)
+    #elif PCD8544_SPI_DIV == 16
+      #define SPI_CLOCK_SPCR                (1 << SPR0)
+      #define SPI_CLOCK_SPSR                0
+    #elif PCD8544_SPI_DIV == 32
+      #define SPI_CLOCK_SPCR                (1 << SPR1)
+      #define SPI_CLOCK_SPSR                (1 << SPI2X)
+    #elif PCD8544_SPI_DIV == 64
+      #define SPI_CLOCK_SPCR                (1 << SPR1)
+      #define SPI_CLOCK_SPSR                0
+    #elif PCD8544_SPI_DIV == 128
+      #define SPI_CLOCK_SPCR                ((1 << SPR1) | (1 << SPR0))
+      #define SPI_CLOCK_SPSR                0
+    #else
+      #error "PCD8544_SPI_DIV has to be 2, 4, 8, 16, 32, 64 or 128"
+    #endif
+    // serial clock of controller is 4 MHz max
+    #if defined(F_CPU) && ((F_CPU / PCD8544_SPI_DIV) > 4000000UL)
+      #error "SPI clock above 4 MHz limit of PCD8544, increase PCD8544_SPI_DIV"
+    #endif
+    // SCK, DIN output, SPI enable, master, clock
+    #define SPI_INIT()                      { DDR  |= (1 << SCK) | (1 << DIN); \
+                                              SPSR  = (SPSR & ~(1 << SPI2X)) | SPI_CLOCK_SPSR; \
+                                              SPCR  = (SPCR & ~((1 << SPR1) | (1 << SPR0))) | \
+                                                      (1 << SPE) | (1 << MSTR) | SPI_CLOCK_SPCR; }
+    // write data register
+    #define SPI_WRITE(data)                 (SPDR = (data))
+    // wait till data transmit
+    #define SPI_WAIT()                      WAIT_UNTIL_BIT_IS_SET (SPSR, SPIF)
+    // read status register
+    #define SPI_STATUS()                    ((void) SPSR)
+
+  #elif PCD8544_TRANSPORT == PCD8544_TRANSPORT_BITBANG
+    // bit-bang pins, default on SPI pins
+    #ifndef PCD8544_BB_PORT
+      #define PCD8544_BB_PORT               PORT
+    #endif
+    #ifndef PCD8544_BB_DDR
+      #define PCD8544_BB_DDR                DDR
+    #endif
+    #ifndef PCD8544_BB_SCK
+      #define PCD8544_BB_SCK                SCK
+    #endif
+    #ifndef PCD8544_BB_DIN
+      #define PCD8544_BB_DIN                DIN
+    #endif
+    // one bit MSB first - DIN while SCK low, sampled on rising edge of SCK
+    // (SCK high 2 cycles = 125 ns at 16 MHz, controller needs 100 ns)
+    #define SPI_BB_BIT(data, bit)           CLR_BIT (PCD8544_BB_PORT, PCD8544_BB_DIN); \
+                                            if ((data) & (1 << (bit))) { \
+                                              SET_BIT (PCD8544_BB_PORT, PCD8544_BB_DIN); \
+                                            } \
+                                            SET_BIT (PCD8544_BB_PORT, PCD8544_BB_SCK); \
+                                            CLR_BIT (PCD8544_BB_PORT, PCD8544_BB_SCK);
+    // SCK, DIN output, SCK idle low
+    #define SPI_INIT()                      { PCD8544_BB_DDR |= (1 << PCD8544_BB_SCK) | (1 << PCD8544_BB_DIN); \
+                                              CLR_BIT (PCD8544_BB_PORT, PCD8544_BB_SCK); }
+    // byte shifted out before return
+    #define SPI_WRITE(data)                 PCD8544_BitBang (data)
+    #define SPI_WAIT()
+    #define SPI_STATUS()
+
+    /**
+     * @desc    Shift byte out on bit-bang pins, unrolled
+     *
+     * @param   uint8_t
+     *
+     * @return  void
+     */
+    static inline void PCD8544_BitBang (uint8_t data)
+    {
+      SPI_BB_BIT (data, 7)
+      SPI_BB_BIT (data, 6)
+      SPI_BB_BIT (data, 5)
+      SPI_BB_BIT (data, 4)
+      SPI_BB_BIT (data, 3)
+      SPI_BB_BIT (data, 2)
+      SPI_BB_BIT (data, 1)
+      SPI_BB_BIT (data, 0)
+    }
+
+  #elif PCD8544_TRANSPORT == PCD8544_TRANSPORT_CAPTURE
+    // byte sink, default emulated controller
+    #ifndef PCD8544_CAPTURE
+      #include "emulator.h"
+      #define PCD8544_CAPTURE(data)         PCD8544_EmuClock (data)
+    #endif
+    #define SPI_INIT()
+    #define SPI_WRITE(data)                 PCD8544_CAPTURE (data)
+    #define SPI_WAIT()
+    #define SPI_STATUS()
+
+  #else
+    #error "Unknown PCD8544_TRANSPORT"
+  #endif
+
+  // asynchronous update needs transfer complete interrupt (SPI_STC_vect,
+  // raised by emulator in capture mode) and whole frame in cache
+  #if (PCD8544_TRANSPORT != PCD8544_TRANSPORT_BITBANG) && !defined(PCD8544_BANDED)
+    #define PCD8544_ASYNC
+  #endif
+
+  #if defined(PCD8544_GRAY_TIMER1) && !defined(PCD8544_ASYNC)
+    #error "Grayscale engine needs asynchronous transfer (no bit-bang, no banded mode)"
+  #endif
+
+  // Several displays (define PCD8544_MULTI)
+  // -----------------------------------
+  // CE / DC of every context toggled through its port pointer with
+  // interrupts masked; without it CE / DC are single SBI / CBI on
+  // compile-time PORT, CE, DC and only pcd8544Default can be driven
+
+  #ifdef PCD8544_HOST
+    // framebuffer byte writes statistics
+    #include "emulator.h"
+    #define FB_WRITES(count)                (pcd8544FbWrites += (count))
+  #else
+    // no statistics on target
+    #define FB_WRITES(count)
+  #endif
+
+  // Display context
+  // -----------------------------------
+  // one per panel, panels share SPI (SCK, DIN), each has own control
+  // pins CE, DC, RST on one port (PCD8544_MULTI)
+  typedef struct {
+  #ifdef PCD8544_BANDED
+    // display list - PCD8544_DLIST_SIZE bytes
+    uint8_t *list;
+    // display list length
+    uint16_t listLen;
+    // display list index of last text record
+    uint16_t listText;
+    // display list index of last sprite layer record
+    uint16_t listSprites;
+  #else
+    // framebuffer - CACHE_SIZE_MEM bytes
+    uint8_t *cache;
+    // dirty span per bank - first / last modified column (clean if from > to)
+    uint8_t dirtyFrom[MAX_NUM_ROWS];
+    uint8_t dirtyTo[MAX_NUM_ROWS];
+    // spans taken from dirty spans for transfer - first / last column
+    // per bank, addressing mode, banks of vertically sent region
+    uint8_t sendFrom[MAX_NUM_ROWS];
+    uint8_t sendTo[MAX_NUM_ROWS];
+    uint8_t sendMode;
+    uint8_t sendBankFirst;
+    uint8_t sendBankLast;
+    // gray plane of weight 1 - CACHE_SIZE_MEM bytes, NULL if monochrome
+    uint8_t *gray;
+  #endif
+    // control port and its data direction register
+    volatile uint8_t *port;
+    volatile uint8_t *ddr;
+    // control pin masks
+    uint8_t ce;
+    uint8_t dc;
+    uint8_t rst;
+    // text cursor (pixel)
+    uint8_t cursorX;
+    uint8_t cursorY;
+    // text font (PROGMEM), NULL built-in 5x7
+    const pcd8544_font_t *font;
+    // shadow of controller - function set, display control,
+    // x / y address pointer (0xFF unknown)
+    uint8_t function;
+    uint8_t display;
+    uint8_t x;
+    uint8_t y;
+  } pcd8544_t;
+
+  // Number field
+  // -----------------------------------
+  // cells of one pitch (widest digit of font) on fixed position,
+  // remembers characters on glass so redraw touches changed cells only
+  typedef struct {
+    // first cell (pixel)
+    uint8_t x;
+    uint8_t y;
+    // number of cells <= PCD8544_FIELD_CELLS
+    uint8_t width;
+    // PCD8544_FIELD_RIGHT / _LEFT / _ZERO
+    uint8_t flags;
+    // font of cells on glass, cell size (pitch 0 - not drawn yet)
+    const pcd8544_font_t *font;
+    uint8_t pitch;
+    uint8_t height;
+    // characters on glass, 0 unknown
+    char cells[PCD8544_FIELD_CELLS];
+  } pcd8544_field_t;
+
+  // Number field initializer
+  // -----------------------------------
+  // col, row - pixel position of first cell
+  // cells - number of cells, flags - PCD8544_FIELD_RIGHT / _LEFT / _ZERO
+  #define PCD8544_FIELD(col, row, cells, opts) { \
+    .x = (col), \
+    .y = (row), \
+    .width = (cells), \
+    .flags = (opts) \
+  }
+
+  // Text console
+  // -----------------------------------
+  // ring of text rows - scrolling moves head, rows are re-rendered
+  // into their banks by flush; zero initialised console is empty
+  typedef struct {
+    // characters of rows
+    char text[PCD8544_CONSOLE_ROWS][PCD8544_CONSOLE_COLS];
+    // ring row on top of screen
+    uint8_t head;
+    // cursor - screen row, column (== PCD8544_CONSOLE_COLS wraps on next character)
+    uint8_t row;
+    uint8_t col;
+    // screen rows changed or moved since last flush, bit per row
+    uint8_t dirty;
+  } pcd8544_console_t;
+
+  // Sprite
+  // -----------------------------------
+  // image with mask composited over framebuffer, bytes under it are
+  // saved and restored when sprite moves
+  typedef struct {
+    // image and mask (PROGMEM), ceil(h/8) banks of w bytes, mask NULL opaque
+    const uint8_t *bitmap;
+    const uint8_t *mask;
+    // background - PCD8544_SPRITE_SAVE(w, h) bytes
+    uint8_t *save;
+    // position and visibility set by application
+    int16_t x;
+    int16_t y;
+    uint8_t visible;
+    // size
+    uint8_t w;
+    uint8_t h;
+    // image, position and visibility on framebuffer
+    const uint8_t *drawnBitmap;
+    int16_t drawnX;
+    int16_t drawnY;
+    uint8_t drawn;
+  } pcd8544_sprite_t;
+
+  // Sprite initializer
+  // -----------------------------------
+  // image, msk - PROGMEM, msk NULL opaque
+  // buffer - PCD8544_SPRITE_SAVE(width, height) bytes
+  // width, height - pixels
+  #define PCD8544_SPRITE(image, msk, buffer, width, height) { \
+    .bitmap = (image), \
+    .mask = (msk), \
+    .save = (buffer), \
+    .w = (width), \
+    .h = (height) \
+  }
+
+  // Strip chart
+  // -----------------------------------
+  // ring of rendered columns - sample renders one column, columns are
+  // rotated to the region (oldest left) when chart is drawn
+  typedef struct {
+    // columns - banks x w bytes, bank b of column c at b * w + c
+    uint8_t *columns;
+    // region - first column, first bank, width, height in banks
+    uint8_t x;
+    uint8_t bank;
+    uint8_t w;
+    uint8_t banks;
+    // ring column of oldest sample
+    uint8_t head;
+    // row of previous sample, 0xFF none
+    uint8_t last;
+    // PCD8544_CHART_DOTS / _LINE
+    uint8_t flags;
+  } pcd8544_chart_t;
+
+  // Strip chart initializer
+  // -----------------------------------
+  // buffer - banks x width bytes, cleared (static or PCD8544_ChartClear)
+  // col, row - first column, first bank of region
+  // width, height - columns, banks of region
+  // opts - PCD8544_CHART_DOTS / _LINE
+  #define PCD8544_CHART(buffer, col, row, width, height, opts) { \
+    .columns = (buffer), \
+    .x = (col), \
+    .bank = (row), \
+    .w = (width), \
+    .banks = (height), \
+    .head = 0, \
+    .last = 0xFF, \
+    .flags = (opts) \
+  }
+
+  // Display context initializer
+  // -----------------------------------
+  // buffer - framebuffer of CACHE_SIZE_MEM bytes, display list of
+  //          PCD8544_DLIST_SIZE bytes if PCD8544_BANDED
+  // portReg, ddrReg - e.g. &PORTD, &DDRD
+  // cePin, dcPin, rstPin - pin numbers on port
+  #ifdef PCD8544_BANDED
+    #define PCD8544_CTX_BUFFER(buffer)      .list = (buffer), .listLen = 0, .listText = 0xFFFF, \
+                                            .listSprites = 0xFFFF
+  #else
+    // after reset content of DDRAM is undefined, so whole frame is dirty
+    #define PCD8544_CTX_BUFFER(buffer)      .cache = (buffer), \
+                                            .dirtyTo = { MAX_NUM_COLS - 1, MAX_NUM_COLS - 1, MAX_NUM_COLS - 1, \
+                                                         MAX_NUM_COLS - 1, MAX_NUM_COLS - 1, MAX_NUM_COLS - 1 }
+  #endif
+  #define PCD8544_CTX(buffer, portReg, ddrReg, cePin, dcPin, rstPin) { \
+    PCD8544_CTX_BUFFER (buffer), \
+    .port = (portReg), \
+    .ddr = (ddrReg), \
+    .ce = (1 << (cePin)), \
+    .dc = (1 << (dcPin)), \
+    .rst = (1 << (rstPin)), \
+    .function = 0xFF, \
+    .display = 0xFF, \
+    .x = 0xFF, \
+    .y = 0xFF \
+  }
+
+  // @var Default display - PORT, DDR, CE, DC, RST, used by functions
+  //      without context
+  extern pcd8544_t pcd8544Default;
+
   /**
    * @desc    Initialise pcd8544 controller
    *
@@ -147,6 +645,15 @@
    */
   void PCD8544_Init (void);
 
+  /**
+   * @desc    Initialise pcd8544 controller
+   *
+   * @param   pcd8544_t *
+   *
+   * @return  void
+   */
+  void PCD8544_InitCtx (pcd8544_t *);
+
   /**
    * @desc    Command send
    *
@@ -156,6 +663,16 @@
    */
   void PCD8544_CommandSend (char);
 
+  /**
+   * @desc    Command send
+   *
+   * @param   pcd8544_t *
+   * @param   char
+   *
+   * @return  void
+   */
+  void PCD8544_CommandSendCtx (pcd8544_t *, char);
+
   /**
    * @desc    Data send
    *
@@ -165,6 +682,119 @@
    */
   void PCD8544_DataSend (char);
 
+  /**
+   * @desc    Data send
+   *
+   * @param   pcd8544_t *
+   * @param   char
+   *
+   * @return  void
+   */
+  void PCD8544_DataSendCtx (pcd8544_t *, char);
+
+  /**
+   * @desc    Command buffer send - CE asserted once for whole buffer
+   *
+   * @param   const uint8_t *
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void PCD8544_CommandSendBuffer (const uint8_t *, uint8_t);
+
+  /**
+   * @desc    Command buffer send - CE asserted once for whole buffer
+   *
+   * @param   pcd8544_t *
+   * @param   const uint8_t *
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void PCD8544_CommandSendBufferCtx (pcd8544_t *, const uint8_t *, uint8_t);
+
+  /**
+   * @desc    Command buffer send from flash - CE asserted once for whole buffer
+   *
+   * @param   const uint8_t * - PROGMEM
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void PCD8544_CommandSendBuffer_P (const uint8_t *, uint8_t);
+
+  /**
+   * @desc    Command buffer send from flash - CE asserted once for whole buffer
+   *
+   * @param   pcd8544_t *
+   * @param   const uint8_t * - PROGMEM
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void PCD8544_CommandSendBufferCtx_P (pcd8544_t *, const uint8_t *, uint8_t);
+
+  /**
+   * @desc    Data buffer send - CE asserted once for whole buffer
+   *
+   * @param   const uint8_t *
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void PCD8544_DataSendBuffer (const uint8_t *, uint16_t);
+
+  /**
+   * @desc    Data buffer send - CE asserted once for whole buffer
+   *
+   * @param   pcd8544_t *
+   * @param   const uint8_t *
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void PCD8544_DataSendBufferCtx (pcd8544_t *, const uint8_t *, uint16_t);
+
+  /**
+   * @desc    Data buffer send from flash - CE asserted once for whole buffer
+   *
+   * @param   const uint8_t * - PROGMEM
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void PCD8544_DataSendBuffer_P (const uint8_t *, uint16_t);
+
+  /**
+   * @desc    Data buffer send from flash - CE asserted once for whole buffer
+   *
+   * @param   pcd8544_t *
+   * @param   const uint8_t * - PROGMEM
+   * @param   uint16_t
+   *
+   * @return  void
+   */
+  void PCD8544_DataSendBufferCtx_P (pcd8544_t *, const uint8_t *, uint16_t);
+
+  /**
+   * @desc    Set display mode - command sent only if mode differs
+   *
+   * @param   uint8_t - DISPLAY_BLANK / NORMAL_MODE / ALL_SEGMS_ON / INVERSE_MODE
+   *
+   * @return  void
+   */
+  void PCD8544_SetDisplayMode (uint8_t);
+
+  /**
+   * @desc    Set display mode - command sent only if mode differs
+   *
+   * @param   pcd8544_t *
+   * @param   uint8_t - DISPLAY_BLANK / NORMAL_MODE / ALL_SEGMS_ON / INVERSE_MODE
+   *
+   * @return  void
+   */
+  void PCD8544_SetDisplayModeCtx (pcd8544_t *, uint8_t);
+
   /**
    * @desc    Reset Impulse
    *
@@ -174,6 +804,15 @@
    */
   void PCD8544_ResetImpulse (void);
 
+  /**
+   * @desc    Reset Impulse
+   *
+   * @param   pcd8544_t *
+   *
+   * @return  void
+   */
+  void PCD8544_ResetImpulseCtx (pcd8544_t *);
+
   /**
    * @desc    Clear screen
    *
@@ -183,8 +822,20 @@
    */
   void PCD8544_ClearScreen (void);
 
+  /**
+   * @desc    Clear screen
+   *
+   * @param   pcd8544_t *
+   *
+   * @return  void
+   */
+  void PCD8544_ClearScreenCtx (pcd8544_t *);
+
   /**
    * @desc    Update screen
+   *          sends only modified column spans of banks, vertically
+   *          addressed columns of tall and narrow region or full frame,
+   *          whichever needs least bytes
    *
    * @param   void
    *
@@ -193,7 +844,91 @@
   void PCD8544_UpdateScreen (void);
 
   /**
-   * @desc    Draw character
+   * @desc    Update screen
+   *          sends only modified column spans of banks, vertically
+   *          addressed columns of tall and narrow region or full frame,
+   *          whichever needs least bytes
+   *
+   * @param   pcd8544_t *
+   *
+   * @return  void
+   */
+  void PCD8544_UpdateScreenCtx (pcd8544_t *);
+
+  /**
+   * @desc    Update screen asynchronously
+   *          first byte is sent immediately, rest is fed from SPI_STC_vect
+   *          (global interrupts must be enabled). Modified spans are taken
+   *          over and marked clean at start, so drawing into cache during
+   *          transfer is allowed: bytes not yet sent carry new content and
+   *          every write is marked dirty again, i.e. it is guaranteed
+   *          on display after next update.
+   *
+   * @param   void
+   *
+   * @return  char - PCD8544_ERROR if transfer still in progress
+   */
+  char PCD8544_UpdateScreenAsync (void);
+
+  /**
+   * @desc    Update screen asynchronously
+   *          first byte is sent immediately, rest is fed from SPI_STC_vect
+   *          (global interrupts must be enabled). Modified spans are taken
+   *          over and marked clean at start, so drawing into cache during
+   *          transfer is allowed: bytes not yet sent carry new content and
+   *          every write is marked dirty again, i.e. it is guaranteed
+   *          on display after next update.
+   *
+   * @param   pcd8544_t *
+   *
+   * @return  char - PCD8544_ERROR if transfer still in progress
+   */
+  char PCD8544_UpdateScreenAsyncCtx (pcd8544_t *);
+
+  /**
+   * @desc    Update screens of displays back to back on shared SPI,
+   *          only CE of displays is switched
+   *
+   * @param   pcd8544_t ** - displays
+   * @param   uint8_t - number of displays
+   *
+   * @return  void
+   */
+  void PCD8544_UpdateScreens (pcd8544_t **, uint8_t);
+
+  /**
+   * @desc    Update screens of displays asynchronously back to back,
+   *          next display is started from SPI_STC_vect, callback is
+   *          called once after last one
+   *
+   * @param   pcd8544_t ** - displays, array has to live until transfer ends
+   * @param   uint8_t - number of displays
+   *
+   * @return  char - PCD8544_ERROR if transfer still in progress
+   */
+  char PCD8544_UpdateScreensAsync (pcd8544_t **, uint8_t);
+
+  /**
+   * @desc    Asynchronous transfer in progress?
+   *
+   * @param   void
+   *
+   * @return  char - 1 busy, 0 complete
+   */
+  char PCD8544_IsBusy (void);
+
+  /**
+   * @desc    Set asynchronous transfer completion callback
+   *          called from interrupt context, NULL disables
+   *
+   * @param   void (*)(void)
+   *
+   * @return  void
+   */
+  void PCD8544_SetCallback (void (*)(void));
+
+  /**
+   * @desc    Draw character on text cursor (any pixel position)
    *
    * @param   char
    *
@@ -202,54 +937,907 @@
   char PCD8544_DrawChar (char);
 
   /**
-   * @desc    Draw string
+   * @desc    Draw character on text cursor (any pixel position)
    *
-   * @param   char *
+   * @param   pcd8544_t *
+   * @param   char
    *
    * @return  char
    */
-  void PCD8544_DrawString (char *);
+  char PCD8544_DrawCharCtx (pcd8544_t *, char);
 
   /**
-   * @desc    Set text position x, y
+   * @desc    Draw code point (Unicode BMP) on text cursor (any pixel position),
+   *          unmapped code points >= 0x80 drawn as fallback glyph of font
    *
-   * @param   char x - position 0 <= x <=  5
-   * @param   char y - position 0 <= y <= 14
+   * @param   uint16_t
    *
    * @return  char
    */
-  char PCD8544_SetTextPosition (char, char);
+  char PCD8544_DrawCode (uint16_t);
 
   /**
-   * @desc    Set pixel position x, y
+   * @desc    Draw code point (Unicode BMP) on text cursor (any pixel position),
+   *          unmapped code points >= 0x80 drawn as fallback glyph of font
    *
-   * @param   char x - position 0 <= x <= 47
-   * @param   char y - position 0 <= y <= 83
+   * @param   pcd8544_t *
+   * @param   uint16_t
    *
    * @return  char
    */
-  char PCD8544_SetPixelPosition (char, char);
+  char PCD8544_DrawCodeCtx (pcd8544_t *, uint16_t);
 
   /**
-   * @desc    Draw pixel on position x, y
+   * @desc    Draw bitmap on x, y position (any pixel)
    *
-   * @param   char x - position
-   * @param   char y - position
+   * @param   const uint8_t * bitmap - PROGMEM, ceil(h/8) banks of w bytes,
+   *                                   bit 0 top row (same as FONTS)
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   uint8_t w - width
+   * @param   uint8_t h - height
+   * @param   uint8_t op - PCD8544_OP_SET (OR) / _CLR / _XOR / _AND / _COPY
    *
    * @return  char
    */
-  char PCD8544_DrawPixel (char, char);
+  char PCD8544_DrawBitmap (const uint8_t *, int16_t, int16_t, uint8_t, uint8_t, uint8_t);
 
   /**
-   * @desc    Draw line
+   * @desc    Draw bitmap on x, y position (any pixel)
    *
-   * @param   char x - start x position
-   * @param   char y - end x position
-   * @param   char x - start y position
-   * @param   char y - end y position
+   * @param   pcd8544_t *
+   * @param   const uint8_t * bitmap - PROGMEM, ceil(h/8) banks of w bytes,
+   *                                   bit 0 top row (same as FONTS)
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   uint8_t w - width
+   * @param   uint8_t h - height
+   * @param   uint8_t op - PCD8544_OP_SET (OR) / _CLR / _XOR / _AND / _COPY
    *
    * @return  char
    */
-  char PCD8544_DrawLine (char, char, char, char);
+  char PCD8544_DrawBitmapCtx (pcd8544_t *, const uint8_t *, int16_t, int16_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw bitmap with transparency mask on x, y position
+   *          pixels outside mask keep background
+   *
+   * @param   const uint8_t * bitmap - PROGMEM
+   * @param   const uint8_t * mask - PROGMEM, same layout as bitmap
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   uint8_t w - width
+   * @param   uint8_t h - height
+   *
+   * @return  char
+   */
+  char PCD8544_DrawBitmapMasked (const uint8_t *, const uint8_t *, int16_t, int16_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw bitmap with transparency mask on x, y position
+   *          pixels outside mask keep background
+   *
+   * @param   pcd8544_t *
+   * @param   const uint8_t * bitmap - PROGMEM
+   * @param   const uint8_t * mask - PROGMEM, same layout as bitmap
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   uint8_t w - width
+   * @param   uint8_t h - height
+   *
+   * @return  char
+   */
+  char PCD8544_DrawBitmapMaskedCtx (pcd8544_t *, const uint8_t *, const uint8_t *, int16_t, int16_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw sprite layer - sprites changed since last call (and ones
+   *          above them) are restored top down and composited bottom up,
+   *          old and new footprints are marked dirty so flush sends only
+   *          their column spans (banded - layer recorded once, sprites
+   *          composited on current positions when bands are rasterized)
+   *
+   * @param   pcd8544_sprite_t * - sprites, first is bottom
+   * @param   uint8_t count
+   *
+   * @return  char
+   */
+  char PCD8544_DrawSprites (pcd8544_sprite_t *, uint8_t);
+
+  /**
+   * @desc    Draw sprite layer - sprites changed since last call (and ones
+   *          above them) are restored top down and composited bottom up,
+   *          old and new footprints are marked dirty so flush sends only
+   *          their column spans (banded - layer recorded once, sprites
+   *          composited on current positions when bands are rasterized)
+   *
+   * @param   pcd8544_t *
+   * @param   pcd8544_sprite_t * - sprites, first is bottom
+   * @param   uint8_t count
+   *
+   * @return  char
+   */
+  char PCD8544_DrawSpritesCtx (pcd8544_t *, pcd8544_sprite_t *, uint8_t);
+
+  /**
+   * @desc    Forget sprites on framebuffer (after ClearScreen or redraw
+   *          of background), next draw saves background again
+   *
+   * @param   pcd8544_sprite_t *
+   * @param   uint8_t count
+   *
+   * @return  void
+   */
+  void PCD8544_SpritesReset (pcd8544_sprite_t *, uint8_t);
+
+  /**
+   * @desc    Draw RLE compressed image (PROGMEM) on bank aligned region,
+   *          streamed straight to controller
+   *
+   * @param   const uint8_t * image - PROGMEM, PCD8544 RLE of banks x w bytes
+   * @param   uint8_t x - first column
+   * @param   uint8_t bank - first bank
+   * @param   uint8_t w - width
+   * @param   uint8_t banks - height in banks
+   * @param   uint8_t flags - PCD8544_IMAGE_CACHE
+   *
+   * @return  char
+   */
+  char PCD8544_DrawImageRle (const uint8_t *, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw RLE compressed image (PROGMEM) on bank aligned region,
+   *          streamed straight to controller
+   *
+   * @param   pcd8544_t *
+   * @param   const uint8_t * image - PROGMEM, PCD8544 RLE of banks x w bytes
+   * @param   uint8_t x - first column
+   * @param   uint8_t bank - first bank
+   * @param   uint8_t w - width
+   * @param   uint8_t banks - height in banks
+   * @param   uint8_t flags - PCD8544_IMAGE_CACHE
+   *
+   * @return  char
+   */
+  char PCD8544_DrawImageRleCtx (pcd8544_t *, const uint8_t *, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw string (UTF-8)
+   *
+   * @param   char *
+   *
+   * @return  char
+   */
+  void PCD8544_DrawString (char *);
+
+  /**
+   * @desc    Draw string (UTF-8)
+   *
+   * @param   pcd8544_t *
+   * @param   char *
+   *
+   * @return  char
+   */
+  void PCD8544_DrawStringCtx (pcd8544_t *, char *);
+
+  /**
+   * @desc    Set text position x, y (cache only, no SPI traffic)
+   *
+   * @param   char x - position 0 <= x <=  5
+   * @param   char y - position 0 <= y <= 14
+   *
+   * @return  char
+   */
+  char PCD8544_SetTextPosition (char, char);
+
+  /**
+   * @desc    Set text position x, y (cache only, no SPI traffic)
+   *
+   * @param   pcd8544_t *
+   * @param   char x - position 0 <= x <=  5
+   * @param   char y - position 0 <= y <= 14
+   *
+   * @return  char
+   */
+  char PCD8544_SetTextPositionCtx (pcd8544_t *, char, char);
+
+  /**
+   * @desc    Set text font - proportional, any height
+   *
+   * @param   const pcd8544_font_t * font - PROGMEM (tools/bdf2pcd), NULL built-in 5x7
+   *
+   * @return  void
+   */
+  void PCD8544_SetFont (const pcd8544_font_t *);
+
+  /**
+   * @desc    Set text font - proportional, any height
+   *
+   * @param   pcd8544_t *
+   * @param   const pcd8544_font_t * font - PROGMEM (tools/bdf2pcd), NULL built-in 5x7
+   *
+   * @return  void
+   */
+  void PCD8544_SetFontCtx (pcd8544_t *, const pcd8544_font_t *);
+
+  /**
+   * @desc    Width of UTF-8 string in current font (without trailing spacing)
+   *
+   * @param   const char *
+   *
+   * @return  uint16_t - pixels
+   */
+  uint16_t PCD8544_StringWidth (const char *);
+
+  /**
+   * @desc    Width of UTF-8 string in current font (without trailing spacing)
+   *
+   * @param   pcd8544_t *
+   * @param   const char *
+   *
+   * @return  uint16_t - pixels
+   */
+  uint16_t PCD8544_StringWidthCtx (pcd8544_t *, const char *);
+
+  /**
+   * @desc    Forget characters of field on glass (after ClearScreen),
+   *          next draw renders all cells
+   *
+   * @param   pcd8544_field_t *
+   *
+   * @return  void
+   */
+  void PCD8544_FieldReset (pcd8544_field_t *);
+
+  /**
+   * @desc    Draw integer into field in current font, only cells whose
+   *          character changed are rendered and only changed bytes of
+   *          cache are marked dirty
+   *
+   * @param   pcd8544_field_t *
+   * @param   int32_t value
+   *
+   * @return  char - error if number does not fit field or field display
+   */
+  char PCD8544_DrawInt (pcd8544_field_t *, int32_t);
+
+  /**
+   * @desc    Draw integer into field in current font, only cells whose
+   *          character changed are rendered and only changed bytes of
+   *          cache are marked dirty
+   *
+   * @param   pcd8544_t *
+   * @param   pcd8544_field_t *
+   * @param   int32_t value
+   *
+   * @return  char - error if number does not fit field or field display
+   */
+  char PCD8544_DrawIntCtx (pcd8544_t *, pcd8544_field_t *, int32_t);
+
+  /**
+   * @desc    Draw fixed-point number into field in current font
+   *          e.g. value 2345 with 2 decimals as 23.45
+   *
+   * @param   pcd8544_field_t *
+   * @param   int32_t value - number * 10^decimals
+   * @param   uint8_t decimals - 0 <= decimals <= 9
+   *
+   * @return  char - error if number does not fit field or field display
+   */
+  char PCD8544_DrawFixed (pcd8544_field_t *, int32_t, uint8_t);
+
+  /**
+   * @desc    Draw fixed-point number into field in current font
+   *          e.g. value 2345 with 2 decimals as 23.45
+   *
+   * @param   pcd8544_t *
+   * @param   pcd8544_field_t *
+   * @param   int32_t value - number * 10^decimals
+   * @param   uint8_t decimals - 0 <= decimals <= 9
+   *
+   * @return  char - error if number does not fit field or field display
+   */
+  char PCD8544_DrawFixedCtx (pcd8544_t *, pcd8544_field_t *, int32_t, uint8_t);
+
+  /**
+   * @desc    Clear console, cursor home (no SPI traffic until flush)
+   *
+   * @param   pcd8544_console_t *
+   *
+   * @return  void
+   */
+  void PCD8544_ConsoleClear (pcd8544_console_t *);
+
+  /**
+   * @desc    Put character on console cursor, wraps and scrolls
+   *          '\n' new line (row start), '\r' row start, '\b' cursor left,
+   *          '\t' next tab stop, PCD8544_CONSOLE_EOL, PCD8544_CONSOLE_CLS
+   *
+   * @param   pcd8544_console_t *
+   * @param   char
+   *
+   * @return  void
+   */
+  void PCD8544_ConsolePutc (pcd8544_console_t *, char);
+
+  /**
+   * @desc    Put string on console
+   *
+   * @param   pcd8544_console_t *
+   * @param   const char *
+   *
+   * @return  void
+   */
+  void PCD8544_ConsolePuts (pcd8544_console_t *, const char *);
+
+  /**
+   * @desc    Render changed or moved console rows into their banks
+   *          and send them
+   *
+   * @param   pcd8544_console_t *
+   *
+   * @return  void
+   */
+  void PCD8544_ConsoleFlush (pcd8544_console_t *);
+
+  /**
+   * @desc    Render changed or moved console rows into their banks
+   *          and send them
+   *
+   * @param   pcd8544_t *
+   * @param   pcd8544_console_t *
+   *
+   * @return  void
+   */
+  void PCD8544_ConsoleFlushCtx (pcd8544_t *, pcd8544_console_t *);
+
+  /**
+   * @desc    Clear strip chart - no samples
+   *
+   * @param   pcd8544_chart_t *
+   *
+   * @return  void
+   */
+  void PCD8544_ChartClear (pcd8544_chart_t *);
+
+  /**
+   * @desc    Append sample to strip chart - renders one column of ring,
+   *          oldest sample drops out on left
+   *
+   * @param   pcd8544_chart_t *
+   * @param   uint8_t value - 0 bottom row, clipped to top row of region
+   *
+   * @return  void
+   */
+  void PCD8544_ChartPush (pcd8544_chart_t *, uint8_t);
+
+  /**
+   * @desc    Draw strip chart - columns of ring rotated into region
+   *          (banded - recorded, rotated when bands are rasterized)
+   *
+   * @param   pcd8544_chart_t *
+   *
+   * @return  char
+   */
+  char PCD8544_DrawChart (pcd8544_chart_t *);
+
+  /**
+   * @desc    Draw strip chart - columns of ring rotated into region
+   *          (banded - recorded, rotated when bands are rasterized)
+   *
+   * @param   pcd8544_t *
+   * @param   pcd8544_chart_t *
+   *
+   * @return  char
+   */
+  char PCD8544_DrawChartCtx (pcd8544_t *, pcd8544_chart_t *);
+
+  /**
+   * @desc    Set pixel position x, y (cache only, no SPI traffic)
+   *
+   * @param   char x - position 0 <= x <= 47
+   * @param   char y - position 0 <= y <= 83
+   *
+   * @return  char
+   */
+  char PCD8544_SetPixelPosition (char, char);
+
+  /**
+   * @desc    Set pixel position x, y (cache only, no SPI traffic)
+   *
+   * @param   pcd8544_t *
+   * @param   char x - position 0 <= x <= 47
+   * @param   char y - position 0 <= y <= 83
+   *
+   * @return  char
+   */
+  char PCD8544_SetPixelPositionCtx (pcd8544_t *, char, char);
+
+  /**
+   * @desc    Draw pixel on position x, y
+   *
+   * @param   char x - position
+   * @param   char y - position
+   *
+   * @return  char
+   */
+  char PCD8544_DrawPixel (char, char);
+
+  /**
+   * @desc    Draw pixel on position x, y
+   *
+   * @param   pcd8544_t *
+   * @param   char x - position
+   * @param   char y - position
+   *
+   * @return  char
+   */
+  char PCD8544_DrawPixelCtx (pcd8544_t *, char, char);
+
+  /**
+   * @desc    Draw line
+   *
+   * @param   char x - start x position
+   * @param   char y - end x position
+   * @param   char x - start y position
+   * @param   char y - end y position
+   *
+   * @return  char
+   */
+  char PCD8544_DrawLine (char, char, char, char);
+
+  /**
+   * @desc    Draw line
+   *
+   * @param   pcd8544_t *
+   * @param   char x - start x position
+   * @param   char y - end x position
+   * @param   char x - start y position
+   * @param   char y - end y position
+   *
+   * @return  char
+   */
+  char PCD8544_DrawLineCtx (pcd8544_t *, char, char, char, char);
+
+  /**
+   * @desc    Draw circle outline
+   *
+   * @param   int16_t x - center column
+   * @param   int16_t y - center row
+   * @param   uint8_t r - radius
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawCircle (int16_t, int16_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw circle outline
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - center column
+   * @param   int16_t y - center row
+   * @param   uint8_t r - radius
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawCircleCtx (pcd8544_t *, int16_t, int16_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Fill circle
+   *
+   * @param   int16_t x - center column
+   * @param   int16_t y - center row
+   * @param   uint8_t r - radius
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_FillCircle (int16_t, int16_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Fill circle
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - center column
+   * @param   int16_t y - center row
+   * @param   uint8_t r - radius
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_FillCircleCtx (pcd8544_t *, int16_t, int16_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw ellipse outline
+   *
+   * @param   int16_t x - center column
+   * @param   int16_t y - center row
+   * @param   uint8_t rx - horizontal radius <= SHAPE_MAX_RADIUS
+   * @param   uint8_t ry - vertical radius <= SHAPE_MAX_RADIUS
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawEllipse (int16_t, int16_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw ellipse outline
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - center column
+   * @param   int16_t y - center row
+   * @param   uint8_t rx - horizontal radius <= SHAPE_MAX_RADIUS
+   * @param   uint8_t ry - vertical radius <= SHAPE_MAX_RADIUS
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawEllipseCtx (pcd8544_t *, int16_t, int16_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Fill ellipse
+   *
+   * @param   int16_t x - center column
+   * @param   int16_t y - center row
+   * @param   uint8_t rx - horizontal radius <= SHAPE_MAX_RADIUS
+   * @param   uint8_t ry - vertical radius <= SHAPE_MAX_RADIUS
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_FillEllipse (int16_t, int16_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Fill ellipse
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - center column
+   * @param   int16_t y - center row
+   * @param   uint8_t rx - horizontal radius <= SHAPE_MAX_RADIUS
+   * @param   uint8_t ry - vertical radius <= SHAPE_MAX_RADIUS
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_FillEllipseCtx (pcd8544_t *, int16_t, int16_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw circular arc counterclockwise from start to end angle
+   *          0 degrees at 3 o'clock, full circle if |end - start| >= 360
+   *
+   * @param   int16_t x - center column
+   * @param   int16_t y - center row
+   * @param   uint8_t r - radius
+   * @param   int16_t start - degrees
+   * @param   int16_t end - degrees
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawArc (int16_t, int16_t, uint8_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Draw circular arc counterclockwise from start to end angle
+   *          0 degrees at 3 o'clock, full circle if |end - start| >= 360
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - center column
+   * @param   int16_t y - center row
+   * @param   uint8_t r - radius
+   * @param   int16_t start - degrees
+   * @param   int16_t end - degrees
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawArcCtx (pcd8544_t *, int16_t, int16_t, uint8_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Fill triangle
+   *
+   * @param   int16_t x0, y0 - first vertex
+   * @param   int16_t x1, y1 - second vertex
+   * @param   int16_t x2, y2 - third vertex
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_FillTriangle (int16_t, int16_t, int16_t, int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Fill triangle
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x0, y0 - first vertex
+   * @param   int16_t x1, y1 - second vertex
+   * @param   int16_t x2, y2 - third vertex
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_FillTriangleCtx (pcd8544_t *, int16_t, int16_t, int16_t, int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Fill convex polygon
+   *
+   * @param   const int16_t * points - x, y pairs in order along outline,
+   *          |coordinate| <= POLYGON_MAX_COORD
+   * @param   uint8_t count - number of vertices
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_FillPolygon (const int16_t *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Fill convex polygon
+   *
+   * @param   pcd8544_t *
+   * @param   const int16_t * points - x, y pairs in order along outline,
+   *          |coordinate| <= POLYGON_MAX_COORD
+   * @param   uint8_t count - number of vertices
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_FillPolygonCtx (pcd8544_t *, const int16_t *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw horizontal line
+   *
+   * @param   int16_t x - start column
+   * @param   int16_t y - row
+   * @param   int16_t w - width
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawHLine (int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Draw horizontal line
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - start column
+   * @param   int16_t y - row
+   * @param   int16_t w - width
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawHLineCtx (pcd8544_t *, int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Draw vertical line
+   *
+   * @param   int16_t x - column
+   * @param   int16_t y - start row
+   * @param   int16_t h - height
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawVLine (int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Draw vertical line
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - column
+   * @param   int16_t y - start row
+   * @param   int16_t h - height
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawVLineCtx (pcd8544_t *, int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Draw rectangle outline
+   *
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   int16_t w - width
+   * @param   int16_t h - height
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawRect (int16_t, int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Draw rectangle outline
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   int16_t w - width
+   * @param   int16_t h - height
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_DrawRectCtx (pcd8544_t *, int16_t, int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Fill rectangle
+   *
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   int16_t w - width
+   * @param   int16_t h - height
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_FillRect (int16_t, int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Fill rectangle
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   int16_t w - width
+   * @param   int16_t h - height
+   * @param   uint8_t op - PCD8544_OP_SET / PCD8544_OP_CLR / PCD8544_OP_XOR
+   *
+   * @return  char
+   */
+  char PCD8544_FillRectCtx (pcd8544_t *, int16_t, int16_t, int16_t, int16_t, uint8_t);
+
+  #ifndef PCD8544_BANDED
+
+  /**
+   * @desc    Scroll region vertically by pixels, vacated rows cleared
+   *          (full cache only - banded strip holds one bank, rows moved
+   *          across banks are not available; console and strip chart
+   *          scroll by their own ring buffers and work in both modes)
+   *
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   int16_t w - width
+   * @param   int16_t h - height
+   * @param   int8_t dy - rows, negative up, positive down
+   *
+   * @return  char
+   */
+  char PCD8544_ScrollRegion (int16_t, int16_t, int16_t, int16_t, int8_t);
+
+  /**
+   * @desc    Scroll region vertically by pixels, vacated rows cleared
+   *          (full cache only)
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   int16_t w - width
+   * @param   int16_t h - height
+   * @param   int8_t dy - rows, negative up, positive down
+   *
+   * @return  char
+   */
+  char PCD8544_ScrollRegionCtx (pcd8544_t *, int16_t, int16_t, int16_t, int16_t, int8_t);
+
+  #endif
+
+  #ifdef PCD8544_ASYNC
+
+  /**
+   * @desc    Start grayscale engine on default display
+   *
+   * @param   uint8_t * - plane of weight 1, CACHE_SIZE_MEM bytes
+   *
+   * @return  char
+   */
+  char PCD8544_GrayStart (uint8_t *);
+
+  /**
+   * @desc    Start grayscale engine
+   *
+   * @param   pcd8544_t *
+   * @param   uint8_t * - plane of weight 1, CACHE_SIZE_MEM bytes
+   *
+   * @return  char
+   */
+  char PCD8544_GrayStartCtx (pcd8544_t *, uint8_t *);
+
+  /**
+   * @desc    Stop grayscale engine
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void PCD8544_GrayStop (void);
+
+  /**
+   * @desc    Next frame of grayscale cycle - timer interrupt body
+   *
+   * @param   void
+   *
+   * @return  char - PCD8544_ERROR if frame dropped
+   */
+  char PCD8544_GrayTick (void);
+
+  /**
+   * @desc    Fill rectangle with gray level
+   *
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   int16_t w - width
+   * @param   int16_t h - height
+   * @param   uint8_t level - PCD8544_GRAY_WHITE / _LIGHT / _DARK / _BLACK
+   *
+   * @return  char
+   */
+  char PCD8544_GrayFillRect (int16_t, int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Fill rectangle with gray level
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   int16_t w - width
+   * @param   int16_t h - height
+   * @param   uint8_t level - PCD8544_GRAY_WHITE / _LIGHT / _DARK / _BLACK
+   *
+   * @return  char
+   */
+  char PCD8544_GrayFillRectCtx (pcd8544_t *, int16_t, int16_t, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Draw pixel with gray level
+   *
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   uint8_t level - PCD8544_GRAY_WHITE / _LIGHT / _DARK / _BLACK
+   *
+   * @return  char
+   */
+  char PCD8544_GrayPixel (int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Draw pixel with gray level
+   *
+   * @param   pcd8544_t *
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   uint8_t level - PCD8544_GRAY_WHITE / _LIGHT / _DARK / _BLACK
+   *
+   * @return  char
+   */
+  char PCD8544_GrayPixelCtx (pcd8544_t *, int16_t, int16_t, uint8_t);
+
+  /**
+   * @desc    Draw gray bitmap - plane of weight 2 followed by plane of weight 1
+   *
+   * @param   const uint8_t * bitmap - PROGMEM, 2 x ceil(h/8) banks of w bytes
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   uint8_t w - width
+   * @param   uint8_t h - height
+   *
+   * @return  char
+   */
+  char PCD8544_GrayDrawBitmap (const uint8_t *, int16_t, int16_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw gray bitmap - plane of weight 2 followed by plane of weight 1
+   *
+   * @param   pcd8544_t *
+   * @param   const uint8_t * bitmap - PROGMEM, 2 x ceil(h/8) banks of w bytes
+   * @param   int16_t x - column
+   * @param   int16_t y - row
+   * @param   uint8_t w - width
+   * @param   uint8_t h - height
+   *
+   * @return  char
+   */
+  char PCD8544_GrayDrawBitmapCtx (pcd8544_t *, const uint8_t *, int16_t, int16_t, uint8_t, uint8_t);
+
+  #endif
 
 #endif
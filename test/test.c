@@ -0,0 +1,953 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @desc        Host tests of drawing and flush paths against emulated controller
+ * --------------------------------------------------------------------------------------------+
+ * @datum       18.10.2026
+ * @file        test.c
+ * @tested      Linux gcc
+ *
+ * @depend      pcd8544.c, emulator.h, prop5x7.h
+ * --------------------------------------------------------------------------------------------+
+ * @usage       test <frames>
+ *              Draws fixed pseudo-random scenes and writes DDRAM of emulated
+ *              controller after every update into frames. Built once with full
+ *              cache and once with -DPCD8544_BANDED, "make test" compares both
+ *              frame files byte by byte. Full cache build also streams random
+ *              draws by sync and async update and checks DDRAM against cache.
+ *              Both builds check features against per-pixel reference.
+ *              Library source is included to reach its cache.
+ *              Exit code 1 if any check fails.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../lib/pcd8544.c"
+#include "prop5x7.h"
+
+// Number of random scenes
+#define TEST_SCENES       500
+
+// Drawing calls per scene - display list of banded build must not overflow
+// (host pointers take 8 bytes, test binary built with PCD8544_DLIST_SIZE 320)
+#define TEST_CALLS        6
+
+// @var Pseudo-random generator state
+static uint32_t testSeed;
+
+// @var Failed checks
+static int testFailures;
+
+// @var array Expected screen, one byte per pixel
+static uint8_t testRef[MAX_NUM_ROWS * 8][MAX_NUM_COLS];
+
+// @const array Bitmap and mask of random blits
+static const uint8_t testBitmap[] PROGMEM = {
+  0x81, 0x42, 0x24, 0x18, 0xFF, 0x00, 0xAA, 0x55, 0x0F, 0xF0, 0x3C, 0xC3,
+  0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C
+};
+
+// @const array Transparency mask of clipped blits (12 x 16)
+static const uint8_t testMask[] PROGMEM = {
+  0xFF, 0xFF, 0x0F, 0x0F, 0xF0, 0xF0, 0x3C, 0x3C, 0x00, 0xFF, 0x81, 0x7E,
+  0xFF, 0x00, 0xFF, 0x00, 0x55, 0xAA, 0x55, 0xAA, 0xFF, 0x0F, 0xF0, 0xFF
+};
+
+/**
+ * @desc    Deterministic pseudo-random number (same sequence in every build)
+ *
+ * @param   uint32_t range
+ *
+ * @return  uint32_t - 0 <= value < range
+ */
+static uint32_t TEST_Random (uint32_t range)
+{
+  testSeed = testSeed * 1103515245u + 12345u;
+  return (testSeed >> 16) % range;
+}
+
+/**
+ * @desc    Record failed check
+ *
+ * @param   int condition
+ * @param   const char * check
+ *
+ * @return  void
+ */
+static void TEST_Check (int condition, const char *check)
+{
+  if (!condition) {
+    fprintf (stderr, "test: %s failed\n", check);
+    testFailures++;
+  }
+}
+
+/**
+ * @desc    Random drawing call, partly off screen
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_RandomCall (void)
+{
+  switch (TEST_Random (11)) {
+    case 0:
+      PCD8544_DrawPixel (TEST_Random (60) - 5, TEST_Random (100) - 5);
+      break;
+    case 1:
+      PCD8544_DrawLine (TEST_Random (200) - 100, TEST_Random (200) - 100,
+                        TEST_Random (200) - 100, TEST_Random (200) - 100);
+      break;
+    case 2:
+      PCD8544_FillRect (TEST_Random (100) - 8, TEST_Random (60) - 8,
+                        TEST_Random (50), TEST_Random (30), TEST_Random (3));
+      break;
+    case 3:
+      PCD8544_DrawRect (TEST_Random (100) - 8, TEST_Random (60) - 8,
+                        TEST_Random (50), TEST_Random (30), TEST_Random (3));
+      break;
+    case 4:
+      PCD8544_DrawBitmap (testBitmap, TEST_Random (100) - 10, TEST_Random (70) - 10,
+                          1 + TEST_Random (12), 1 + TEST_Random (16), TEST_Random (5));
+      break;
+    case 5:
+      PCD8544_DrawBitmapMasked (testBitmap, testBitmap + 4, TEST_Random (100) - 10, TEST_Random (70) - 10,
+                                1 + TEST_Random (8), 1 + TEST_Random (16));
+      break;
+    case 6:
+      // UTF-8 - mapped extended glyphs, unmapped code point (fallback glyph)
+      PCD8544_SetFont (&prop5x7);
+      PCD8544_SetPixelPosition (TEST_Random (MAX_NUM_ROWS * 8), TEST_Random (MAX_NUM_COLS));
+      PCD8544_DrawString ("\u017elut\u00fd k\u016f\u0148 \u20ac5");
+      PCD8544_SetFont (0);
+      break;
+    case 7:
+      PCD8544_FillCircle (TEST_Random (100) - 8, TEST_Random (60) - 6,
+                          TEST_Random (30), TEST_Random (3));
+      break;
+    case 8:
+      PCD8544_DrawCircle (TEST_Random (100) - 8, TEST_Random (60) - 6,
+                          TEST_Random (30), TEST_Random (3));
+      break;
+    case 9:
+      PCD8544_FillTriangle (TEST_Random (120) - 18, TEST_Random (70) - 11,
+                            TEST_Random (120) - 18, TEST_Random (70) - 11,
+                            TEST_Random (120) - 18, TEST_Random (70) - 11, TEST_Random (3));
+      break;
+    default:
+      PCD8544_SetPixelPosition (TEST_Random (MAX_NUM_ROWS * 8), TEST_Random (MAX_NUM_COLS));
+      PCD8544_DrawString ("Hello 123");
+      break;
+  }
+}
+
+/**
+ * @desc    Random scenes, DDRAM after every update into frames
+ *
+ * @param   FILE * frames
+ *
+ * @return  void
+ */
+static void TEST_Scenes (FILE *frames)
+{
+  int scene, call;
+
+  testSeed = 1;
+  for (scene = 0; scene < TEST_SCENES; scene++) {
+    PCD8544_ClearScreen ();
+    for (call = 0; call < TEST_CALLS; call++) {
+      TEST_RandomCall ();
+    }
+    PCD8544_UpdateScreen ();
+    fwrite (pcd8544Emu.ddram, 1, sizeof(pcd8544Emu.ddram), frames);
+  }
+  TEST_Check (pcd8544Emu.errors == 0, "scenes: controller errors");
+}
+
+/**
+ * @desc    Set pixel of expected screen, off screen ignored
+ *
+ * @param   int16_t x - column
+ * @param   int16_t y - row
+ * @param   uint8_t on
+ *
+ * @return  void
+ */
+static void TEST_RefPixel (int16_t x, int16_t y, uint8_t on)
+{
+  if ((x >= 0) && (x < MAX_NUM_COLS) && (y >= 0) && (y < (MAX_NUM_ROWS * 8))) {
+    testRef[y][x] = on;
+  }
+}
+
+/**
+ * @desc    Compare emulated DDRAM (and cache of full cache build) with
+ *          expected screen pixel by pixel
+ *
+ * @param   const char * check
+ *
+ * @return  void
+ */
+static void TEST_Match (const char *check)
+{
+  int x, y;
+
+  for (y = 0; y < (MAX_NUM_ROWS * 8); y++) {
+    for (x = 0; x < MAX_NUM_COLS; x++) {
+#ifndef PCD8544_BANDED
+      if (((cacheMemLcd[(y >> 3) * MAX_NUM_COLS + x] >> (y & 7)) & 1) != testRef[y][x]) {
+        fprintf (stderr, "test: %s cache pixel %d, %d\n", check, x, y);
+        TEST_Check (0, check);
+        return;
+      }
+#endif
+      if (PCD8544_EmuPixel (x, y) != testRef[y][x]) {
+        fprintf (stderr, "test: %s ddram pixel %d, %d\n", check, x, y);
+        TEST_Check (0, check);
+        return;
+      }
+    }
+  }
+}
+
+/**
+ * @desc    Update screen and compare with expected screen
+ *
+ * @param   const char * check
+ *
+ * @return  void
+ */
+static void TEST_Compare (const char *check)
+{
+  PCD8544_UpdateScreen ();
+  TEST_Match (check);
+}
+
+/**
+ * @desc    Update screen and take emulated DDRAM as expected screen
+ *          (reference drawn by simpler calls)
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_RefScreen (void)
+{
+  int x, y;
+
+  PCD8544_UpdateScreen ();
+  for (y = 0; y < (MAX_NUM_ROWS * 8); y++) {
+    for (x = 0; x < MAX_NUM_COLS; x++) {
+      testRef[y][x] = PCD8544_EmuPixel (x, y);
+    }
+  }
+}
+
+/**
+ * @desc    Blits partly off screen on every side with every operation
+ *          and with mask over filled background, against per-pixel
+ *          reference
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_Blit (void)
+{
+  static const int16_t xs[] = { -11, -7, -1, 0, 5, 75, 83 };
+  static const int16_t ys[] = { -15, -9, -3, -1, 0, 6, 37, 44 };
+  uint8_t i, j, op, c, r;
+  uint8_t bit, mask, pixel;
+  int16_t x, y;
+
+  for (op = 0; op <= PCD8544_OP_AND + 1; op++) {
+    for (i = 0; i < sizeof(xs) / sizeof(xs[0]); i++) {
+      for (j = 0; j < sizeof(ys) / sizeof(ys[0]); j++) {
+        x = xs[i];
+        y = ys[j];
+        // background - rectangle across blit edges
+        PCD8544_ClearScreen ();
+        memset (testRef, 0, sizeof(testRef));
+        PCD8544_FillRect (x + 3, y + 4, 20, 20, PCD8544_OP_SET);
+        for (r = 0; r < 20; r++) {
+          for (c = 0; c < 20; c++) {
+            TEST_RefPixel (x + 3 + c, y + 4 + r, 1);
+          }
+        }
+        // 12 x 13 blit, last one masked
+        if (op > PCD8544_OP_AND) {
+          PCD8544_DrawBitmapMasked (testBitmap, testMask, x, y, 12, 13);
+        } else {
+          PCD8544_DrawBitmap (testBitmap, x, y, 12, 13, op);
+        }
+        for (r = 0; r < 13; r++) {
+          for (c = 0; c < 12; c++) {
+            if (((x + c) < 0) || ((x + c) >= MAX_NUM_COLS) || ((y + r) < 0) || ((y + r) >= (MAX_NUM_ROWS * 8))) {
+              continue;
+            }
+            bit = (pgm_read_byte (&testBitmap[(r >> 3) * 12 + c]) >> (r & 7)) & 1;
+            mask = (pgm_read_byte (&testMask[(r >> 3) * 12 + c]) >> (r & 7)) & 1;
+            pixel = testRef[y + r][x + c];
+            switch (op) {
+              case PCD8544_OP_SET:  pixel |= bit; break;
+              case PCD8544_OP_CLR:  pixel &= !bit; break;
+              case PCD8544_OP_XOR:  pixel ^= bit; break;
+              case PCD8544_OP_COPY: pixel = bit; break;
+              case PCD8544_OP_AND:  pixel &= bit; break;
+              default:              pixel = mask ? bit : pixel; break;
+            }
+            testRef[y + r][x + c] = pixel;
+          }
+        }
+        TEST_Compare ("blit: clipped pixels");
+      }
+    }
+  }
+}
+
+/**
+ * @desc    Compress image by PCD8544 RLE (packet 0x00 - 0x7F: c + 1
+ *          literal bytes, 0x80 - 0xFF: next byte repeated (c & 0x7F) + 3)
+ *
+ * @param   const uint8_t * raw
+ * @param   int len
+ * @param   uint8_t * rle
+ *
+ * @return  int - compressed length
+ */
+static int TEST_RleEncode (const uint8_t *raw, int len, uint8_t *rle)
+{
+  int i = 0, out = 0, run, lit;
+
+  while (i < len) {
+    for (run = 1; ((i + run) < len) && (raw[i + run] == raw[i]) && (run < 130); run++);
+    if (run >= 3) {
+      rle[out++] = 0x80 | (run - 3);
+      rle[out++] = raw[i];
+      i += run;
+      continue;
+    }
+    // literals up to next run of 3
+    for (lit = 1; ((i + lit) < len) && (lit < 128); lit++) {
+      if (((i + lit + 2) < len) && (raw[i + lit] == raw[i + lit + 1]) && (raw[i + lit] == raw[i + lit + 2])) {
+        break;
+      }
+    }
+    rle[out++] = lit - 1;
+    memcpy (&rle[out], &raw[i], lit);
+    out += lit;
+    i += lit;
+  }
+  return out;
+}
+
+/**
+ * @desc    RLE images of random runs and literals on bank aligned regions,
+ *          decoded stream must equal raw image in DDRAM (and cache)
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_Rle (void)
+{
+  static const uint8_t regions[][4] = {
+    { 0, 0, MAX_NUM_COLS, MAX_NUM_ROWS }, { 7, 1, 40, 3 }, { 60, 4, 24, 2 }, { 83, 5, 1, 1 }
+  };
+  static uint8_t raw[CACHE_SIZE_MEM];
+  static uint8_t rle[CACHE_SIZE_MEM * 2];
+  uint8_t i, x, bank, w, banks, b, c;
+  uint8_t value;
+  int len, n;
+
+  testSeed = 5;
+  for (i = 0; i < sizeof(regions) / sizeof(regions[0]); i++) {
+    x = regions[i][0];
+    bank = regions[i][1];
+    w = regions[i][2];
+    banks = regions[i][3];
+    len = w * banks;
+    // runs of random length, every other run literal
+    for (n = 0; n < len; ) {
+      value = TEST_Random (256);
+      for (c = 1 + TEST_Random (20); c && (n < len); c--) {
+        raw[n] = (i & 1) ? value : (value + c * (n & 1));
+        n++;
+      }
+    }
+    TEST_RleEncode (raw, len, rle);
+    PCD8544_ClearScreen ();
+    PCD8544_UpdateScreen ();
+    PCD8544_EmuResetCounters ();
+    TEST_Check (PCD8544_DrawImageRle (rle, x, bank, w, banks, PCD8544_IMAGE_CACHE) == PCD8544_SUCCESS, "rle: draw");
+    TEST_Check (pcd8544Emu.data == (uint32_t) len, "rle: data bytes");
+    for (b = 0; b < banks; b++) {
+      for (c = 0; c < w; c++) {
+        if (pcd8544Emu.ddram[bank + b][x + c] != raw[b * w + c]) {
+          TEST_Check (0, "rle: ddram equals raw image");
+          return;
+        }
+#ifndef PCD8544_BANDED
+        if (cacheMemLcd[(bank + b) * MAX_NUM_COLS + x + c] != raw[b * w + c]) {
+          TEST_Check (0, "rle: cache equals raw image");
+          return;
+        }
+#endif
+      }
+    }
+  }
+  // region off screen
+  TEST_Check (PCD8544_DrawImageRle (rle, 80, 0, 5, 1, 0) == PCD8544_ERROR, "rle: region range");
+  TEST_Check (pcd8544Emu.errors == 0, "rle: controller errors");
+}
+
+/**
+ * @desc    Number fields redrawn over previous number, against text of
+ *          same characters - built-in font by DrawString of whole text,
+ *          proportional font glyph by glyph centered in cells
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_Field (void)
+{
+  static const struct {
+    const pcd8544_font_t *font;
+    uint8_t x, y, width, flags;
+    int32_t value;
+    uint8_t decimals;
+    const char *text;
+  } steps[] = {
+    { 0,        3,  5, 6, PCD8544_FIELD_RIGHT, 12345,  0, " 12345" },
+    { 0,        3,  5, 6, PCD8544_FIELD_RIGHT, -42,    0, "   -42" },
+    { 0,        3,  5, 6, PCD8544_FIELD_LEFT,  -42,    1, "-4.2  " },
+    { 0,        9, 40, 7, PCD8544_FIELD_ZERO,  -7,     2, "-000.07" },
+    { 0,        9, 40, 7, PCD8544_FIELD_ZERO,  123456, 2, "1234.56" },
+    { &prop5x7, 2, 13, 8, PCD8544_FIELD_RIGHT, 90817,  3, "  90.817" },
+    { &prop5x7, 2, 13, 8, PCD8544_FIELD_RIGHT, -1,     3, "  -0.001" },
+    { &prop5x7, 1, 27, 9, PCD8544_FIELD_LEFT,  -1234,  0, "-1234    " }
+  };
+  pcd8544_field_t field;
+  glyph_t glyph;
+  uint8_t index;
+  char text[PCD8544_FIELD_CELLS + 1];
+  uint8_t i, c, x;
+
+  for (i = 1; i < sizeof(steps) / sizeof(steps[0]); i++) {
+    PCD8544_SetFont (steps[i].font);
+    // reference - text of same characters
+    PCD8544_ClearScreen ();
+    if (!steps[i].font) {
+      strcpy (text, steps[i].text);
+      PCD8544_SetPixelPosition (steps[i].y, steps[i].x);
+      PCD8544_DrawString (text);
+    } else {
+      TEST_Check (PCD8544_FieldPitch (&pcd8544Default, &field) == PCD8544_SUCCESS, "field: pitch");
+      for (c = 0, x = steps[i].x; steps[i].text[c]; c++, x += field.pitch) {
+        if ((PCD8544_GlyphIndex (steps[i].font, steps[i].text[c], &index) == PCD8544_SUCCESS) &&
+            (PCD8544_GlyphAt (steps[i].font, index, &glyph) == PCD8544_SUCCESS)) {
+          text[0] = steps[i].text[c];
+          text[1] = 0;
+          PCD8544_SetPixelPosition (steps[i].y, x + ((field.pitch - glyph.advance) >> 1));
+          PCD8544_DrawString (text);
+        }
+      }
+    }
+    TEST_RefScreen ();
+    // field - previous number of same field, then this one over it
+    PCD8544_ClearScreen ();
+    field = (pcd8544_field_t) PCD8544_FIELD (steps[i].x, steps[i].y, steps[i].width, steps[i].flags);
+    PCD8544_FieldReset (&field);
+    if ((steps[i - 1].x == steps[i].x) && (steps[i - 1].y == steps[i].y)) {
+      field.flags = steps[i - 1].flags;
+      TEST_Check (PCD8544_DrawFixed (&field, steps[i - 1].value, steps[i - 1].decimals) == PCD8544_SUCCESS, "field: draw previous");
+      PCD8544_UpdateScreen ();
+      field.flags = steps[i].flags;
+    }
+    TEST_Check (PCD8544_DrawFixed (&field, steps[i].value, steps[i].decimals) == PCD8544_SUCCESS, "field: draw");
+    TEST_Check (!memcmp (field.cells, steps[i].text, steps[i].width), "field: cells");
+    TEST_Compare ("field: equals text");
+  }
+  // number wider than field
+  TEST_Check (PCD8544_DrawInt (&field, 1234567890) == PCD8544_ERROR, "field: number range");
+  PCD8544_SetFont (0);
+  TEST_Check (pcd8544Emu.errors == 0, "field: controller errors");
+}
+
+/**
+ * @desc    Console wrapped, scrolled and edited by control characters,
+ *          flushed after every step, against DrawString of expected rows
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_Console (void)
+{
+  static const struct {
+    const char *input;
+    const char *rows[PCD8544_CONSOLE_ROWS];
+  } steps[] = {
+    { "\fone\ntwo\n",        { "one", "two", "", "", "", "" } },
+    { "abcdefghijklmnopq",     { "one", "two", "abcdefghijklmn", "opq", "", "" } },
+    { "\n3\n4\n5",            { "two", "abcdefghijklmn", "opq", "3", "4", "5" } },
+    { "\rX\tY\bZ",            { "two", "abcdefghijklmn", "opq", "3", "4", "X   Z" } },
+    { "\r\v0123456789ABCDEFGH\xC3",
+                               { "abcdefghijklmn", "opq", "3", "4", "0123456789ABCD", "EFGH?" } },
+    { "\x01\t\t\t\t!",        { "opq", "3", "4", "0123456789ABCD", "EFGH?", "!" } }
+  };
+  static pcd8544_console_t console;
+  char text[PCD8544_CONSOLE_COLS + 1];
+  uint8_t i, k, row;
+
+  for (i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+    // reference - rows drawn as strings
+    PCD8544_ClearScreen ();
+    for (row = 0; row < PCD8544_CONSOLE_ROWS; row++) {
+      strcpy (text, steps[i].rows[row]);
+      PCD8544_SetPixelPosition (row * 8, 0);
+      PCD8544_DrawString (text);
+    }
+    TEST_RefScreen ();
+    // console - steps flushed one by one over blank screen
+    PCD8544_ClearScreen ();
+    PCD8544_UpdateScreen ();
+    for (k = 0; k <= i; k++) {
+      PCD8544_ConsolePuts (&console, steps[k].input);
+      PCD8544_ConsoleFlush (&console);
+    }
+    TEST_Match ("console: equals strings");
+  }
+  TEST_Check (pcd8544Emu.errors == 0, "console: controller errors");
+}
+
+/**
+ * @desc    Strip charts of dots and lines over filled screen, pushed past
+ *          width of ring, against per-pixel reference of sample history
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_Chart (void)
+{
+  static const uint8_t charts[][5] = {
+    { 0, 0, MAX_NUM_COLS, MAX_NUM_ROWS, PCD8544_CHART_LINE },
+    { 10, 1, 30, 2, PCD8544_CHART_DOTS },
+    { 50, 3, 17, 3, PCD8544_CHART_LINE },
+    { 83, 5, 1, 1, PCD8544_CHART_LINE }
+  };
+  static uint8_t columns[CACHE_SIZE_MEM];
+  uint8_t samples[200];
+  pcd8544_chart_t chart;
+  int i, n, count, j, k, y, top, bottom, from, to;
+
+  testSeed = 6;
+  for (i = 0; i < (int) (sizeof(charts) / sizeof(charts[0])); i++) {
+    chart = (pcd8544_chart_t) PCD8544_CHART (columns, charts[i][0], charts[i][1], charts[i][2], charts[i][3], charts[i][4]);
+    PCD8544_ChartClear (&chart);
+    top = charts[i][1] * 8;
+    bottom = top + charts[i][3] * 8 - 1;
+    // fewer samples than columns, then ring wrapped
+    for (count = 1; count < (int) sizeof(samples); count += 1 + TEST_Random (3 * charts[i][2])) {
+      for (n = 0; n < count; n++) {
+        // values above region clipped to top row
+        samples[n] = TEST_Random (charts[i][3] * 8 + 4);
+      }
+      PCD8544_ChartClear (&chart);
+      for (n = 0; n < count; n++) {
+        PCD8544_ChartPush (&chart, samples[n]);
+      }
+      // reference - filled screen, column j of region shows sample k
+      memset (testRef, 1, sizeof(testRef));
+      for (j = 0; j < charts[i][2]; j++) {
+        for (y = top; y <= bottom; y++) {
+          testRef[y][charts[i][0] + j] = 0;
+        }
+        k = count - charts[i][2] + j;
+        if (k < 0) {
+          continue;
+        }
+        from = to = bottom - ((samples[k] > (bottom - top)) ? (bottom - top) : samples[k]);
+        // segment from row of previous sample
+        if ((charts[i][4] & PCD8544_CHART_LINE) && (k > 0)) {
+          y = bottom - ((samples[k - 1] > (bottom - top)) ? (bottom - top) : samples[k - 1]);
+          from = (y < from) ? y : from;
+          to = (y > to) ? y : to;
+        }
+        for (y = from; y <= to; y++) {
+          testRef[y][charts[i][0] + j] = 1;
+        }
+      }
+      PCD8544_ClearScreen ();
+      PCD8544_FillRect (0, 0, MAX_NUM_COLS, MAX_NUM_ROWS * 8, PCD8544_OP_SET);
+      TEST_Check (PCD8544_DrawChart (&chart) == PCD8544_SUCCESS, "chart: draw");
+      TEST_Compare ("chart: equals samples");
+    }
+  }
+  // region off screen
+  chart.x = 80;
+  chart.w = 5;
+  TEST_Check (PCD8544_DrawChart (&chart) == PCD8544_ERROR, "chart: region range");
+  TEST_Check (pcd8544Emu.errors == 0, "chart: controller errors");
+}
+
+/**
+ * @desc    Overlapping sprites moved, hidden and shown over random scenes,
+ *          partly off screen - hiding all restores background, in cache
+ *          byte for byte (full cache build) and on glass
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_Sprites (void)
+{
+  static uint8_t save[3][PCD8544_SPRITE_SAVE (12, 16)];
+  pcd8544_sprite_t sprites[3] = {
+    PCD8544_SPRITE (testBitmap, testMask, save[0], 12, 16),
+    PCD8544_SPRITE (testBitmap, 0, save[1], 8, 8),
+    PCD8544_SPRITE (testBitmap + 12, testMask, save[2], 12, 13)
+  };
+#ifndef PCD8544_BANDED
+  static uint8_t background[CACHE_SIZE_MEM];
+#endif
+  int i, n, k;
+
+  testSeed = 8;
+  for (i = 0; i < 100; i++) {
+    PCD8544_ClearScreen ();
+    for (n = 0; n < TEST_CALLS; n++) {
+      TEST_RandomCall ();
+    }
+    PCD8544_SpritesReset (sprites, 3);
+    TEST_RefScreen ();
+#ifndef PCD8544_BANDED
+    memcpy (background, cacheMemLcd, CACHE_SIZE_MEM);
+#endif
+    // moves of some sprites, some hidden
+    for (n = 0; n < 12; n++) {
+      for (k = 0; k < 3; k++) {
+        if (TEST_Random (2)) {
+          continue;
+        }
+        sprites[k].x = TEST_Random (100) - 14;
+        sprites[k].y = TEST_Random (70) - 17;
+        sprites[k].visible = TEST_Random (4) != 0;
+      }
+      TEST_Check (PCD8544_DrawSprites (sprites, 3) == PCD8544_SUCCESS, "sprites: draw");
+      PCD8544_UpdateScreen ();
+    }
+    // all hidden
+    for (k = 0; k < 3; k++) {
+      sprites[k].visible = 0;
+    }
+    TEST_Check (PCD8544_DrawSprites (sprites, 3) == PCD8544_SUCCESS, "sprites: hide");
+#ifndef PCD8544_BANDED
+    if (memcmp (background, cacheMemLcd, CACHE_SIZE_MEM)) {
+      TEST_Check (0, "sprites: restore equals cache");
+      return;
+    }
+#endif
+    TEST_Compare ("sprites: restore equals background");
+  }
+  TEST_Check (pcd8544Emu.errors == 0, "sprites: controller errors");
+}
+
+/**
+ * @desc    Screen of one shape drawn with PCD8544_OP_SET on blank screen
+ *
+ * @param   uint8_t shape - 0 ellipse outline, 1 ellipse fill, 2 arc, 3 circle fill
+ * @param   const int16_t * p - x, y, rx, ry, start, end
+ * @param   uint8_t (*screen)[MAX_NUM_COLS]
+ *
+ * @return  void
+ */
+static void TEST_Shape (uint8_t shape, const int16_t *p, uint8_t (*screen)[MAX_NUM_COLS])
+{
+  PCD8544_ClearScreen ();
+  switch (shape) {
+    case 0:
+      PCD8544_DrawEllipse (p[0], p[1], p[2], p[3], PCD8544_OP_SET);
+      break;
+    case 1:
+      PCD8544_FillEllipse (p[0], p[1], p[2], p[3], PCD8544_OP_SET);
+      break;
+    case 2:
+      PCD8544_DrawArc (p[0], p[1], p[2], p[4], p[5], PCD8544_OP_SET);
+      break;
+    default:
+      PCD8544_FillCircle (p[0], p[1], p[2], PCD8544_OP_SET);
+      break;
+  }
+  TEST_RefScreen ();
+  memcpy (screen, testRef, sizeof(testRef));
+}
+
+/**
+ * @desc    Random ellipses and arcs partly off screen - outline pixels
+ *          inside fill of same shape, fill one span per row
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_Ellipse (void)
+{
+  static uint8_t outline[MAX_NUM_ROWS * 8][MAX_NUM_COLS];
+  static uint8_t fill[MAX_NUM_ROWS * 8][MAX_NUM_COLS];
+  int16_t p[6];
+  int i, x, y, spans;
+
+  testSeed = 9;
+  for (i = 0; i < 600; i++) {
+    p[0] = TEST_Random (120) - 18;
+    p[1] = TEST_Random (80) - 16;
+    p[2] = TEST_Random ((i & 1) ? 50 : (SHAPE_MAX_RADIUS + 1));
+    p[3] = TEST_Random ((i & 1) ? 30 : (SHAPE_MAX_RADIUS + 1));
+    p[4] = TEST_Random (1440) - 720;
+    p[5] = TEST_Random (1440) - 720;
+    // ellipse, arc against circle fill of its radius
+    TEST_Shape ((i & 2) ? 2 : 0, p, outline);
+    TEST_Shape ((i & 2) ? 3 : 1, p, fill);
+    for (y = 0; y < (MAX_NUM_ROWS * 8); y++) {
+      spans = 0;
+      for (x = 0; x < MAX_NUM_COLS; x++) {
+        if (outline[y][x] && !fill[y][x]) {
+          fprintf (stderr, "test: shape %d (%d, %d, %d, %d) pixel %d, %d\n", i, p[0], p[1], p[2], p[3], x, y);
+          TEST_Check (0, "ellipse: fill covers outline");
+          return;
+        }
+        spans += fill[y][x] && (!x || !fill[y][x - 1]);
+      }
+      if (spans > 1) {
+        TEST_Check (0, "ellipse: fill one span per row");
+        return;
+      }
+    }
+  }
+  TEST_Check (pcd8544Emu.errors == 0, "ellipse: controller errors");
+}
+
+#ifndef PCD8544_BANDED
+/**
+ * @desc    Scroll random regions of random scenes, partly off screen,
+ *          up and down, against rows moved in per-pixel reference
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_Scroll (void)
+{
+  static uint8_t moved[MAX_NUM_ROWS * 8][MAX_NUM_COLS];
+  int16_t x, y, w, h, x0, x1, y0, y1, row, col;
+  int8_t dy;
+  int i, n;
+
+  testSeed = 7;
+  for (i = 0; i < 400; i++) {
+    PCD8544_ClearScreen ();
+    for (n = 0; n < TEST_CALLS; n++) {
+      TEST_RandomCall ();
+    }
+    TEST_RefScreen ();
+    x = TEST_Random (100) - 8;
+    y = TEST_Random (60) - 6;
+    w = TEST_Random (90);
+    h = TEST_Random (56);
+    dy = TEST_Random (2 * 50) - 50;
+    // region clipped to display
+    x0 = (x < 0) ? 0 : x;
+    y0 = (y < 0) ? 0 : y;
+    x1 = ((x + w - 1) >= MAX_NUM_COLS) ? (MAX_NUM_COLS - 1) : (x + w - 1);
+    y1 = ((y + h - 1) >= (MAX_NUM_ROWS * 8)) ? (MAX_NUM_ROWS * 8 - 1) : (y + h - 1);
+    if ((x0 > x1) || (y0 > y1)) {
+      TEST_Check (PCD8544_ScrollRegion (x, y, w, h, dy) == PCD8544_ERROR, "scroll: region range");
+      continue;
+    }
+    // rows of region from dy away, vacated rows cleared
+    memcpy (moved, testRef, sizeof(moved));
+    for (row = y0; row <= y1; row++) {
+      for (col = x0; col <= x1; col++) {
+        moved[row][col] = (((row - dy) >= y0) && ((row - dy) <= y1)) ? testRef[row - dy][col] : 0;
+      }
+    }
+    memcpy (testRef, moved, sizeof(testRef));
+    TEST_Check (PCD8544_ScrollRegion (x, y, w, h, dy) == PCD8544_SUCCESS, "scroll: draw");
+    TEST_Compare ("scroll: equals moved rows");
+  }
+  TEST_Check (pcd8544Emu.errors == 0, "scroll: controller errors");
+}
+#endif
+
+#ifdef PCD8544_ASYNC
+/**
+ * @desc    Gray levels of random rectangles and pixels - every pixel dark
+ *          in level of 3 frames of cycle, only plane switches are sent
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_Gray (void)
+{
+  static uint8_t plane[CACHE_SIZE_MEM];
+  static const uint16_t sent[PCD8544_GRAY_FRAMES] = { CACHE_SIZE_MEM, 0, CACHE_SIZE_MEM };
+  uint8_t frames[MAX_NUM_ROWS * 8][MAX_NUM_COLS];
+  int16_t x, y, w, h, c, r;
+  uint8_t level, tick;
+  int i;
+
+  testSeed = 4;
+  PCD8544_ClearScreen ();
+  memset (testRef, 0, sizeof(testRef));
+  TEST_Check (PCD8544_GrayStart (plane) == PCD8544_SUCCESS, "gray: start");
+  // testRef holds levels
+  for (i = 0; i < 40; i++) {
+    x = TEST_Random (100) - 8;
+    y = TEST_Random (60) - 6;
+    level = TEST_Random (4);
+    if (i & 1) {
+      w = 1 + TEST_Random (30);
+      h = 1 + TEST_Random (20);
+      PCD8544_GrayFillRect (x, y, w, h, level);
+    } else {
+      w = h = 1;
+      PCD8544_GrayPixel (x, y, level);
+    }
+    for (r = y; r < (y + h); r++) {
+      for (c = x; c < (x + w); c++) {
+        TEST_RefPixel (c, r, level);
+      }
+    }
+  }
+  // monochrome pixel into plane of weight 2 only
+  PCD8544_DrawPixel (20, 40);
+  testRef[20][40] |= PCD8544_GRAY_DARK;
+  // one cycle, dark frames per pixel
+  memset (frames, 0, sizeof(frames));
+  for (tick = 0; tick < PCD8544_GRAY_FRAMES; tick++) {
+    PCD8544_EmuResetCounters ();
+    TEST_Check (PCD8544_GrayTick () == PCD8544_SUCCESS, "gray: tick");
+    PCD8544_EmuService ();
+    TEST_Check (pcd8544Emu.data == sent[tick], "gray: plane switch bytes");
+    for (r = 0; r < (MAX_NUM_ROWS * 8); r++) {
+      for (c = 0; c < MAX_NUM_COLS; c++) {
+        frames[r][c] += PCD8544_EmuPixel (c, r);
+      }
+    }
+  }
+  PCD8544_GrayStop ();
+  TEST_Check (!memcmp (frames, testRef, sizeof(frames)), "gray: dark frames equal level");
+  TEST_Check (pcd8544Emu.errors == 0, "gray: controller errors");
+}
+#endif
+
+#ifndef PCD8544_BANDED
+/**
+ * @desc    Random draws accumulated over updates, after every update DDRAM
+ *          must equal cache - dirty spans cover every modified byte
+ *
+ * @param   uint8_t async - flush by SPI interrupt
+ *
+ * @return  void
+ */
+static void TEST_Stream (uint8_t async)
+{
+  int update, call;
+
+  testSeed = 2 + async;
+  PCD8544_ClearScreen ();
+  PCD8544_EmuResetCounters ();
+  for (update = 0; update < TEST_SCENES; update++) {
+    // occasionally whole frame
+    if (!TEST_Random (50)) {
+      PCD8544_ClearScreen ();
+    }
+    for (call = TEST_Random (TEST_CALLS); call >= 0; call--) {
+      TEST_RandomCall ();
+    }
+    if (async) {
+      TEST_Check (PCD8544_UpdateScreenAsync () == PCD8544_SUCCESS, "stream: async start");
+      PCD8544_EmuService ();
+      TEST_Check (!PCD8544_IsBusy (), "stream: async finished");
+    } else {
+      PCD8544_UpdateScreen ();
+    }
+    if (memcmp (pcd8544Emu.ddram, cacheMemLcd, sizeof(pcd8544Emu.ddram))) {
+      TEST_Check (0, async ? "stream: async ddram equals cache" : "stream: sync ddram equals cache");
+      break;
+    }
+  }
+  TEST_Check (pcd8544Emu.errors == 0, "stream: controller errors");
+}
+#endif
+
+#ifdef PCD8544_BANDED
+/**
+ * @desc    Full display list - records up to the limit are drawn, later
+ *          calls are rejected with PCD8544_ERROR and not drawn
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TEST_ListOverflow (void)
+{
+  int stored = 0;
+  int i;
+
+  PCD8544_ClearScreen ();
+  // pixel records until list is full
+  while (PCD8544_DrawPixel (stored % (MAX_NUM_ROWS * 8), stored / (MAX_NUM_ROWS * 8)) == PCD8544_SUCCESS) {
+    stored++;
+  }
+  TEST_Check (stored == PCD8544_DLIST_SIZE / 3, "overflow: records stored");
+  PCD8544_UpdateScreen ();
+  for (i = 0; i <= stored; i++) {
+    TEST_Check (PCD8544_EmuPixel (i / (MAX_NUM_ROWS * 8), i % (MAX_NUM_ROWS * 8)) == (i < stored),
+                "overflow: pixels drawn");
+  }
+}
+#endif
+
+int main (int argc, char **argv)
+{
+  FILE *frames;
+
+  if (argc < 2) {
+    fprintf (stderr, "usage: %s <frames>\n", argv[0]);
+    return 2;
+  }
+  frames = fopen (argv[1], "wb");
+  if (!frames) {
+    fprintf (stderr, "test: cannot write frames %s\n", argv[1]);
+    return 2;
+  }
+  PCD8544_Init ();
+  TEST_Scenes (frames);
+  fclose (frames);
+  TEST_Blit ();
+  TEST_Rle ();
+  TEST_Field ();
+  TEST_Console ();
+  TEST_Chart ();
+  TEST_Sprites ();
+  TEST_Ellipse ();
+#ifdef PCD8544_BANDED
+  TEST_ListOverflow ();
+#else
+  TEST_Scroll ();
+  TEST_Gray ();
+  TEST_Stream (0);
+  TEST_Stream (1);
+#endif
+  if (testFailures) {
+    printf ("test: %d check(s) failed\n", testFailures);
+    return 1;
+  }
+  printf ("test: ok\n");
+  return 0;
+}
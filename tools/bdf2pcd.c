@@ -0,0 +1,411 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @desc        BDF font to PROGMEM compiler for PCD8544 (host tool)
+ * --------------------------------------------------------------------------------------------+
+ * @datum       18.10.2026
+ * @file        bdf2pcd.c
+ * @tested      Linux gcc
+ *
+ * @depend
+ * --------------------------------------------------------------------------------------------+
+ * @usage       bdf2pcd [-n name] [-s chars] [-p spacing] [-f char] in.bdf out.h
+ *
+ *              Input is bitmap font in BDF 2.1 format (X11 fonts, converters from
+ *              TTF / PCF / bitmap editors). Output is C header with PROGMEM tables and
+ *              pcd8544_font_t descriptor for PCD8544_SetFont - glyph columns in native
+ *              vertical-byte bank order of the controller (ceil(height/8) banks of width
+ *              bytes per glyph, bit 0 top row), width and offset of every glyph. ASCII
+ *              glyphs are indexed directly by character - first, glyphs of code points
+ *              0x80 - 0xFFFF follow in order of sorted map of code points.
+ *
+ *              -n name     descriptor name, default file name of input
+ *              -s chars    subset (UTF-8) - only glyphs of characters in chars are stored,
+ *                          direct index covers first .. last ASCII of them only,
+ *                          up to 256 entries of index in total
+ *              -p spacing  columns between glyphs, default 1
+ *              -f char     ASCII glyph drawn for unmapped code points, default '?',
+ *                          always stored
+ *
+ *              Height of font is FONT_ASCENT + FONT_DESCENT (FONTBOUNDINGBOX if missing),
+ *              up to 48 rows. Glyph width is its ink box from origin (BBX xoff + w),
+ *              advance is width + spacing, DWIDTH and kerning are ignored.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+
+// Code points 1 - 0xFFFF (0 is string terminator)
+#define FONT_CHARS        0x10000
+
+// Directly indexed code points 1 - 0x7F, mapped code points from
+#define FONT_MAPPED       0x80
+
+// Maximum number of mapped code points
+#define FONT_EXTRA_MAX    255
+
+// Maximum font height (whole display)
+#define FONT_HEIGHT_MAX   48
+
+// Descriptor size on target - 4 pointers of 2 bytes, 6 bytes
+#define FONT_DESC_SIZE    14
+
+// @type Glyph - columns in vertical-byte banks
+typedef struct {
+  int width;
+  uint8_t *columns;
+} Glyph;
+
+// @type Font
+typedef struct {
+  int height;
+  int ascent;
+  Glyph glyphs[FONT_CHARS];
+} Font;
+
+/**
+ * @desc    Load BDF font
+ *
+ * @param   const char * - path
+ * @param   Font *
+ *
+ * @return  int - 0 success
+ */
+static int FONT_Load (const char *path, Font *font)
+{
+  FILE *file = fopen (path, "r");
+  char line[256];
+  int descent = -1, bbh = 0, bby = 0;
+  int code = -1, w = 0, h = 0, xo = 0, yo = 0;
+  int banks = 0, row, col, x, y = 0, bitmap = 0;
+  int digits, nibble;
+  Glyph *glyph = NULL;
+
+  if (!file) {
+    fprintf (stderr, "bdf2pcd: cannot open %s\n", path);
+    return -1;
+  }
+  font->ascent = -1;
+  while (fgets (line, sizeof(line), file)) {
+    // bitmap row of glyph, hex MSB first
+    if (bitmap) {
+      if (!strncmp (line, "ENDCHAR", 7)) {
+        bitmap = 0;
+        continue;
+      }
+      // hex digits of row
+      digits = strspn (line, "0123456789abcdefABCDEF");
+      for (x = 0; glyph && (x < w) && (x < digits * 4); x++) {
+        col = xo + x;
+        row = font->ascent - yo - h + y;
+        nibble = isdigit ((unsigned char) line[x >> 2]) ? line[x >> 2] - '0' : (toupper ((unsigned char) line[x >> 2]) - 'A' + 10);
+        if ((col < 0) || (row < 0) || (row >= font->height) ||
+            !((nibble >> (3 - (x & 0x03))) & 1)) {
+          continue;
+        }
+        glyph->columns[(row >> 3) * glyph->width + col] |= 1 << (row & 0x07);
+      }
+      y++;
+      continue;
+    }
+    // font properties
+    if (!strncmp (line, "FONTBOUNDINGBOX ", 16)) {
+      sscanf (line + 16, "%*d %d %*d %d", &bbh, &bby);
+    } else if (!strncmp (line, "FONT_ASCENT ", 12)) {
+      font->ascent = atoi (line + 12);
+    } else if (!strncmp (line, "FONT_DESCENT ", 13)) {
+      descent = atoi (line + 13);
+    // glyph
+    } else if (!strncmp (line, "ENCODING ", 9)) {
+      code = atoi (line + 9);
+    } else if (!strncmp (line, "BBX ", 4)) {
+      sscanf (line + 4, "%d %d %d %d", &w, &h, &xo, &yo);
+    } else if (!strncmp (line, "BITMAP", 6)) {
+      // height known with first glyph
+      if (!font->height) {
+        if ((font->ascent < 0) || (descent < 0)) {
+          font->ascent = bbh + bby;
+          descent = -bby;
+        }
+        font->height = font->ascent + descent;
+        if ((font->height <= 0) || (font->height > FONT_HEIGHT_MAX)) {
+          fprintf (stderr, "bdf2pcd: %s has height %d, 1 - %d supported\n", path, font->height, FONT_HEIGHT_MAX);
+          fclose (file);
+          return -1;
+        }
+      }
+      banks = (font->height + 7) / 8;
+      glyph = NULL;
+      // code points 1 - 0xFFFF only, glyph box from origin
+      if ((code > 0) && (code < FONT_CHARS) && (xo + w < 256)) {
+        glyph = &font->glyphs[code];
+        free (glyph->columns);
+        glyph->width = (xo + w > 0) ? xo + w : 1;
+        glyph->columns = calloc ((size_t) banks * glyph->width, 1);
+      }
+      bitmap = 1;
+      y = 0;
+    }
+  }
+  fclose (file);
+  if (!font->height) {
+    fprintf (stderr, "bdf2pcd: %s has no glyph\n", path);
+    return -1;
+  }
+  return 0;
+}
+
+/**
+ * @desc    Decode next code point of UTF-8 string (up to 3 bytes)
+ *
+ * @param   const char ** - string, moved after sequence
+ *
+ * @return  int - code point, -1 invalid
+ */
+static int FONT_Utf8 (const char **str)
+{
+  const uint8_t *byte = (const uint8_t *) *str;
+  int code = *byte++;
+  int follow = 0;
+
+  if ((code & 0xE0) == 0xC0) {
+    code &= 0x1F;
+    follow = 1;
+  } else if ((code & 0xF0) == 0xE0) {
+    code &= 0x0F;
+    follow = 2;
+  } else if (code >= 0x80) {
+    code = -1;
+  }
+  while ((code >= 0) && follow--) {
+    code = ((*byte & 0xC0) == 0x80) ? (code << 6) | (*byte++ & 0x3F) : -1;
+  }
+  *str = (const char *) byte;
+  return code;
+}
+
+/**
+ * @desc    Write C header
+ *
+ * @param   FILE *
+ * @param   const char * - name
+ * @param   const char * - source path
+ * @param   Font *
+ * @param   const uint8_t * - subset, nonzero for stored code points
+ * @param   int - spacing
+ * @param   int - fallback character
+ *
+ * @return  int - 0 success
+ */
+static int FONT_Write (FILE *file, const char *name, const char *source, Font *font, const uint8_t *subset, int spacing, int fallback)
+{
+  static int order[FONT_MAPPED + FONT_EXTRA_MAX];
+  char upper[64], label[4];
+  int banks = (font->height + 7) / 8;
+  int first = -1, last = -2, entries = 0, extra = 0, glyphs = 0, size = 0, remaining;
+  int c, i, n;
+
+  // range of stored ASCII characters
+  for (c = 1; c < FONT_MAPPED; c++) {
+    if (subset[c] && font->glyphs[c].width) {
+      first = (first < 0) ? c : first;
+      last = c;
+    }
+  }
+  // glyph entries - directly indexed range, then mapped code points ascending
+  for (c = first; (first > 0) && (c <= last); c++) {
+    order[entries++] = c;
+  }
+  for (c = FONT_MAPPED; c < FONT_CHARS; c++) {
+    if (subset[c] && font->glyphs[c].width) {
+      if (extra == FONT_EXTRA_MAX) {
+        fprintf (stderr, "bdf2pcd: more than %d code points >= 0x80 in subset of %s\n", FONT_EXTRA_MAX, source);
+        return -1;
+      }
+      order[entries++] = c;
+      extra++;
+    }
+  }
+  // glyph index is byte
+  if (entries > 256) {
+    fprintf (stderr, "bdf2pcd: more than 256 glyph entries in subset of %s\n", source);
+    return -1;
+  }
+  for (i = 0; i < entries; i++) {
+    if (subset[order[i]] && font->glyphs[order[i]].width) {
+      glyphs++;
+      size += banks * font->glyphs[order[i]].width;
+    }
+  }
+  if (!glyphs) {
+    fprintf (stderr, "bdf2pcd: no glyph of subset in %s\n", source);
+    return -1;
+  }
+  if (size > 0xFFFF) {
+    fprintf (stderr, "bdf2pcd: %s has more than 65535 bytes of glyphs\n", source);
+    return -1;
+  }
+  // fallback has to be stored
+  if ((fallback < first) || (fallback > last) || !font->glyphs[fallback].width) {
+    fallback = 0;
+  }
+  first = (first > 0) ? first : 1;
+  for (i = 0; name[i] && (i < 63); i++) {
+    upper[i] = toupper ((unsigned char) name[i]);
+  }
+  upper[i] = '\0';
+  fprintf (file, "/**\n * @desc    %s - generated by bdf2pcd from %s, do not edit\n", name, source);
+  fprintf (file, " *          %d glyphs, %d mapped code points, height %d (%d bank%s), spacing %d\n",
+           glyphs, extra, font->height, banks, (banks > 1) ? "s" : "", spacing);
+  fprintf (file, " */\n#ifndef __%s_H__\n#define __%s_H__\n\n", upper, upper);
+  fprintf (file, "  #include <stdint.h>\n  #include <avr/pgmspace.h>\n  #include \"font.h\"\n\n");
+  fprintf (file, "  #define %s_HEIGHT  %d\n", upper, font->height);
+  fprintf (file, "  #define %s_SIZE    %d\n\n", upper, size + entries * 3 + extra * 2 + FONT_DESC_SIZE);
+  // glyph columns
+  remaining = size;
+  fprintf (file, "  static const uint8_t %s_bitmap[] PROGMEM = {", name);
+  for (i = 0, n = 0; i < entries; i++) {
+    c = order[i];
+    if (!subset[c] || !font->glyphs[c].width) {
+      continue;
+    }
+    // printable label as in font.c, UTF-8 above ASCII
+    memset (label, 0, sizeof(label));
+    if (c >= 0x800) {
+      label[0] = 0xE0 | (c >> 12);
+      label[1] = 0x80 | ((c >> 6) & 0x3F);
+      label[2] = 0x80 | (c & 0x3F);
+    } else if (c >= FONT_MAPPED) {
+      label[0] = 0xC0 | (c >> 6);
+      label[1] = 0x80 | (c & 0x3F);
+    } else if (isgraph (c) && (c != '\\')) {
+      label[0] = c;
+    }
+    if (c >= FONT_MAPPED) {
+      fprintf (file, "\n    // U+%04X %s", c, label);
+    } else {
+      fprintf (file, "\n    // 0x%02x%s%s", c, ((c == ' ') || (c == '\\') || label[0]) ? " " : "",
+               (c == ' ') ? "space" : (c == '\\') ? "backslash" : label);
+    }
+    for (n = 0; n < banks * font->glyphs[c].width; n++) {
+      fprintf (file, "%s0x%02x%s", (n % 12) ? " " : "\n    ", font->glyphs[c].columns[n], (--remaining > 0) ? "," : "");
+    }
+  }
+  fprintf (file, "\n  };\n\n");
+  // offsets
+  fprintf (file, "  static const uint16_t %s_offset[] PROGMEM = {", name);
+  for (i = 0, n = 0; i < entries; i++) {
+    c = order[i];
+    fprintf (file, "%s%d%s", (i % 12) ? " " : "\n    ", n, (i < entries - 1) ? "," : "");
+    if (subset[c] && font->glyphs[c].width) {
+      n += banks * font->glyphs[c].width;
+    }
+  }
+  fprintf (file, "\n  };\n\n");
+  // widths, 0 not stored
+  fprintf (file, "  static const uint8_t %s_width[] PROGMEM = {", name);
+  for (i = 0; i < entries; i++) {
+    c = order[i];
+    fprintf (file, "%s%d%s", (i % 12) ? " " : "\n    ",
+             subset[c] ? font->glyphs[c].width : 0, (i < entries - 1) ? "," : "");
+  }
+  fprintf (file, "\n  };\n\n");
+  // sorted code points >= 0x80
+  if (extra) {
+    fprintf (file, "  static const uint16_t %s_map[] PROGMEM = {", name);
+    for (i = 0; i < extra; i++) {
+      fprintf (file, "%s0x%04x%s", (i % 8) ? " " : "\n    ", order[entries - extra + i], (i < extra - 1) ? "," : "");
+    }
+    fprintf (file, "\n  };\n\n");
+  }
+  // descriptor
+  fprintf (file, "  static const pcd8544_font_t %s PROGMEM = {\n", name);
+  fprintf (file, "    %s_bitmap, %s_offset, %s_width, %s%s, 0x%02x, %d, %d, 0x%02x, %d, %d\n  };\n\n#endif\n",
+           name, name, name, extra ? name : "0", extra ? "_map" : "", first, entries - extra, extra, fallback,
+           font->height, spacing);
+  return 0;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   int
+ * @param   char **
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  const char *usage = "usage: bdf2pcd [-n name] [-s chars] [-p spacing] [-f char] in.bdf out.h\n";
+  static Font font;
+  static uint8_t subset[FONT_CHARS];
+  char name[64] = "";
+  const char *chars = NULL;
+  const char *in, *out, *base;
+  int spacing = 1, fallback = '?';
+  int i, code, status;
+  FILE *file;
+
+  // options
+  for (i = 1; (i < argc) && (argv[i][0] == '-'); i++) {
+    if (!strcmp (argv[i], "-n") && (i + 1 < argc)) {
+      snprintf (name, sizeof(name), "%s", argv[++i]);
+    } else if (!strcmp (argv[i], "-s") && (i + 1 < argc)) {
+      chars = argv[++i];
+    } else if (!strcmp (argv[i], "-p") && (i + 1 < argc)) {
+      spacing = atoi (argv[++i]);
+    } else if (!strcmp (argv[i], "-f") && (i + 1 < argc)) {
+      fallback = (uint8_t) argv[++i][0];
+    } else {
+      fputs (usage, stderr);
+      return 2;
+    }
+  }
+  if ((argc - i != 2) || (spacing < 0) || (spacing > 255) || (fallback >= FONT_MAPPED)) {
+    fputs (usage, stderr);
+    return 2;
+  }
+  in = argv[i];
+  out = argv[i + 1];
+  // descriptor name from file name - identifier characters only
+  if (!name[0]) {
+    base = strrchr (in, '/') ? strrchr (in, '/') + 1 : in;
+    for (i = 0; base[i] && (base[i] != '.') && (i < 63); i++) {
+      name[i] = isalnum ((unsigned char) base[i]) ? base[i] : '_';
+    }
+    name[i] = '\0';
+    if (!name[0] || isdigit ((unsigned char) name[0])) {
+      name[0] = '_';
+    }
+  }
+  // subset, whole font by default
+  memset (subset, !chars, sizeof(subset));
+  while (chars && *chars) {
+    code = FONT_Utf8 (&chars);
+    if (code <= 0) {
+      fprintf (stderr, "bdf2pcd: invalid UTF-8 in subset\n");
+      return 2;
+    }
+    subset[code] = 1;
+  }
+  // fallback glyph
+  subset[fallback] = 1;
+  // glyphs
+  if (FONT_Load (in, &font)) {
+    return 1;
+  }
+  // header
+  file = fopen (out, "w");
+  if (!file) {
+    fprintf (stderr, "bdf2pcd: cannot write %s\n", out);
+    return 1;
+  }
+  status = FONT_Write (file, name, in, &font, subset, spacing, fallback);
+  fclose (file);
+  if (status) {
+    remove (out);
+    return 1;
+  }
+  return 0;
+}
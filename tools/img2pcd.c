@@ -0,0 +1,513 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @desc        Image to PROGMEM converter for PCD8544 (host tool)
+ * --------------------------------------------------------------------------------------------+
+ * @datum       18.10.2026
+ * @file        img2pcd.c
+ * @tested      Linux gcc
+ *
+ * @depend
+ * --------------------------------------------------------------------------------------------+
+ * @usage       img2pcd [-n name] [-d threshold|ordered|fs] [-t level] [-i] [-c] [-r] [-g] in out.h
+ *
+ *              Input is netpbm image PBM / PGM / PPM (P1 - P6), other formats (PNG, ...)
+ *              have to be converted first, e.g. 'pngtopnm img.png > img.ppm'.
+ *              Output is C header with PROGMEM array in native vertical-byte bank order of
+ *              the controller - ceil(h/8) banks of w bytes, bit 0 top row - accepted as is
+ *              by PCD8544_DrawBitmap (PCD8544_GrayDrawBitmap with -g).
+ *
+ *              -n name     array name, default file name of input
+ *              -d mode     threshold, ordered (Bayer 8x8) or fs (Floyd-Steinberg), default fs
+ *              -t level    threshold 0 - 255 of darkness, default 128
+ *              -i          invert, light pixels are set
+ *              -c          crop to bounding box of set pixels, offset in <NAME>_X, <NAME>_Y
+ *              -r          RLE compress (PCD8544 RLE, see below) for PCD8544_DrawImageRle,
+ *                          crop is then aligned to bank, first bank in <NAME>_BANK
+ *              -g          4 gray levels, plane of weight 2 followed by plane of weight 1
+ *
+ *              PCD8544 RLE - sequence of packets
+ *              0x00 - 0x7F  c + 1 literal bytes follow
+ *              0x80 - 0xFF  next byte repeated (c & 0x7F) + 3 times
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+
+// Dithering modes
+#define DITHER_THRESHOLD  0
+#define DITHER_ORDERED    1
+#define DITHER_FS         2
+
+// RLE packets
+#define RLE_LITERAL_MAX   128
+#define RLE_RUN_MIN       3
+#define RLE_RUN_MAX       130
+
+// @type Image - darkness 0 (white) .. 255 (black) per pixel
+typedef struct {
+  int width;
+  int height;
+  uint8_t *pixels;
+} Image;
+
+// @const Bayer matrix 8x8
+static const uint8_t bayer[8][8] = {
+  {  0, 32,  8, 40,  2, 34, 10, 42 },
+  { 48, 16, 56, 24, 50, 18, 58, 26 },
+  { 12, 44,  4, 36, 14, 46,  6, 38 },
+  { 60, 28, 52, 20, 62, 30, 54, 22 },
+  {  3, 35, 11, 43,  1, 33,  9, 41 },
+  { 51, 19, 59, 27, 49, 17, 57, 25 },
+  { 15, 47,  7, 39, 13, 45,  5, 37 },
+  { 63, 31, 55, 23, 61, 29, 53, 21 }
+};
+
+/**
+ * @desc    Read next header token of netpbm file, skip comments
+ *
+ * @param   FILE *
+ *
+ * @return  int - value, -1 on error
+ */
+static int IMG_Token (FILE *file)
+{
+  int c, value = 0;
+  // skip white space and comments
+  do {
+    c = fgetc (file);
+    if (c == '#') {
+      while ((c != '\n') && (c != EOF)) {
+        c = fgetc (file);
+      }
+    }
+  } while (isspace (c));
+  // number expected
+  if (!isdigit (c)) {
+    return -1;
+  }
+  while (isdigit (c)) {
+    value = value * 10 + (c - '0');
+    c = fgetc (file);
+  }
+  // single white space after token
+  return value;
+}
+
+/**
+ * @desc    Load netpbm image (P1 - P6) as darkness
+ *
+ * @param   const char * - path
+ * @param   Image *
+ *
+ * @return  int - 0 success
+ */
+static int IMG_Load (const char *path, Image *image)
+{
+  FILE *file = fopen (path, "rb");
+  int type, maxval = 1;
+  int x, y, i, c, byte = 0;
+  int rgb[3];
+  long lum;
+
+  if (!file) {
+    fprintf (stderr, "img2pcd: cannot open %s\n", path);
+    return -1;
+  }
+  // magic number
+  if ((fgetc (file) != 'P') || ((type = fgetc (file) - '0') < 1) || (type > 6)) {
+    fprintf (stderr, "img2pcd: %s is not netpbm image (P1 - P6)\n", path);
+    fclose (file);
+    return -1;
+  }
+  // header
+  image->width = IMG_Token (file);
+  image->height = IMG_Token (file);
+  if ((type != 1) && (type != 4)) {
+    maxval = IMG_Token (file);
+  }
+  if ((image->width <= 0) || (image->height <= 0) || (maxval <= 0) || (maxval > 65535)) {
+    fprintf (stderr, "img2pcd: %s has invalid header\n", path);
+    fclose (file);
+    return -1;
+  }
+  image->pixels = malloc ((size_t) image->width * image->height);
+  if (!image->pixels) {
+    fclose (file);
+    return -1;
+  }
+  // pixels
+  for (y = 0; y < image->height; y++) {
+    for (x = 0; x < image->width; x++) {
+      // components of pixel
+      for (i = 0; i < ((type == 3) || (type == 6) ? 3 : 1); i++) {
+        switch (type) {
+          // ascii bits, white space between them optional
+          case 1:
+            do {
+              c = fgetc (file);
+              if (c == '#') {
+                while ((c != '\n') && (c != EOF)) {
+                  c = fgetc (file);
+                }
+              }
+            } while (isspace (c));
+            c = ((c == '0') || (c == '1')) ? (c - '0') : -1;
+            break;
+          // ascii
+          case 2:
+          case 3:
+            c = IMG_Token (file);
+            break;
+          // packed bits, rows padded to byte
+          case 4:
+            if ((x & 0x07) == 0) {
+              byte = fgetc (file);
+            }
+            c = (byte < 0) ? -1 : (byte >> (7 - (x & 0x07))) & 0x01;
+            break;
+          // binary, 1 or 2 bytes big endian
+          default:
+            c = fgetc (file);
+            if (maxval > 255) {
+              c = (c << 8) | fgetc (file);
+            }
+            break;
+        }
+        if ((c < 0) || (c > maxval)) {
+          fprintf (stderr, "img2pcd: %s is truncated\n", path);
+          fclose (file);
+          return -1;
+        }
+        rgb[i] = c;
+      }
+      // bitmap - 1 is black
+      if ((type == 1) || (type == 4)) {
+        image->pixels[y * image->width + x] = rgb[0] ? 255 : 0;
+        continue;
+      }
+      // luminance of color
+      if ((type == 3) || (type == 6)) {
+        lum = (299L * rgb[0] + 587L * rgb[1] + 114L * rgb[2]) / 1000;
+      } else {
+        lum = rgb[0];
+      }
+      // darkness 0 - 255
+      image->pixels[y * image->width + x] = 255 - (uint8_t) ((lum * 255 + maxval / 2) / maxval);
+    }
+  }
+  fclose (file);
+  return 0;
+}
+
+/**
+ * @desc    Quantize darkness to levels by dithering
+ *
+ * @param   Image * - darkness in, level 0 .. levels - 1 out
+ * @param   int - levels 2 or 4
+ * @param   int - dithering mode
+ * @param   int - threshold (2 levels)
+ *
+ * @return  void
+ */
+static void IMG_Dither (Image *image, int levels, int mode, int threshold)
+{
+  int w = image->width, h = image->height;
+  int x, y, q;
+  // step between levels
+  int step = 255 / (levels - 1);
+  // error rows, one pixel border on both sides
+  int *errors = calloc (2 * (w + 2), sizeof(int));
+  int *cur = errors + 1, *next = errors + w + 3;
+  int *swap;
+  int value;
+
+  for (y = 0; y < h; y++) {
+    for (x = 0; x < w; x++) {
+      value = image->pixels[y * w + x];
+      switch (mode) {
+        // Bayer threshold map shifts value by -1/2 .. +1/2 step
+        case DITHER_ORDERED:
+          value += ((2 * bayer[y & 7][x & 7] + 1) * step) / 128 - step / 2;
+          q = (value < 0) ? 0 : (value + step / 2) / step;
+          break;
+        // error of neighbours added, own error diffused 7, 3, 5, 1 / 16
+        case DITHER_FS:
+          value = value * 16 + cur[x];
+          if (levels == 2) {
+            q = (value >= threshold * 16) ? 1 : 0;
+          } else {
+            q = (value < 0) ? 0 : (value + step * 8) / (step * 16);
+          }
+          if (q > levels - 1) {
+            q = levels - 1;
+          }
+          value -= q * step * 16;
+          cur[x + 1] += value * 7 / 16;
+          next[x - 1] += value * 3 / 16;
+          next[x] += value * 5 / 16;
+          next[x + 1] += value / 16;
+          break;
+        // plain threshold
+        default:
+          q = (levels == 2) ? (value >= threshold) : (value + step / 2) / step;
+          break;
+      }
+      if (q > levels - 1) {
+        q = levels - 1;
+      }
+      image->pixels[y * w + x] = q;
+    }
+    // next row of errors
+    swap = cur;
+    cur = next;
+    next = swap;
+    memset (next - 1, 0, (w + 2) * sizeof(int));
+  }
+  free (errors);
+}
+
+/**
+ * @desc    Pack levels into planes in vertical-byte bank order
+ *
+ * @param   const Image *
+ * @param   int x0, y0 - crop origin
+ * @param   int w, h - crop size
+ * @param   int planes - 1 or 2 (weight 2 first)
+ * @param   uint8_t * - out, planes * ceil(h/8) * w bytes
+ *
+ * @return  int - bytes
+ */
+static int IMG_Pack (const Image *image, int x0, int y0, int w, int h, int planes, uint8_t *out)
+{
+  int banks = (h + 7) / 8;
+  int p, x, y, q, bit;
+  memset (out, 0, (size_t) planes * banks * w);
+  for (p = 0; p < planes; p++) {
+    // weight of plane
+    bit = (planes == 2) ? (1 - p) : 0;
+    for (y = 0; y < h; y++) {
+      for (x = 0; x < w; x++) {
+        q = image->pixels[(y0 + y) * image->width + x0 + x];
+        if ((q >> bit) & 0x01) {
+          out[p * banks * w + (y >> 3) * w + x] |= 1 << (y & 0x07);
+        }
+      }
+    }
+  }
+  return planes * banks * w;
+}
+
+/**
+ * @desc    RLE compress - literal packets and runs of 3 - 130 bytes
+ *
+ * @param   const uint8_t * - in
+ * @param   int - length
+ * @param   uint8_t * - out, length + length / 128 + 1 bytes
+ *
+ * @return  int - compressed length
+ */
+static int IMG_Rle (const uint8_t *in, int len, uint8_t *out)
+{
+  int i = 0, n = 0, run, literal = -1;
+  while (i < len) {
+    // length of run at i
+    run = 1;
+    while ((i + run < len) && (run < RLE_RUN_MAX) && (in[i + run] == in[i])) {
+      run++;
+    }
+    if (run >= RLE_RUN_MIN) {
+      // run packet
+      out[n++] = 0x80 | (run - RLE_RUN_MIN);
+      out[n++] = in[i];
+      i += run;
+      literal = -1;
+    } else {
+      // open new literal packet or extend current
+      if ((literal < 0) || (out[literal] == RLE_LITERAL_MAX - 1)) {
+        literal = n;
+        out[n++] = 0xFF;
+      }
+      out[literal]++;
+      out[n++] = in[i++];
+    }
+  }
+  return n;
+}
+
+/**
+ * @desc    Write C header
+ *
+ * @param   FILE *
+ * @param   const char * - name
+ * @param   const char * - source
+ * @param   const uint8_t * - data
+ * @param   int - length
+ * @param   int x, y, w, h
+ * @param   int - rle
+ * @param   int - planes
+ *
+ * @return  void
+ */
+static void IMG_Write (FILE *file, const char *name, const char *source, const uint8_t *data, int len,
+                       int x, int y, int w, int h, int rle, int planes)
+{
+  char upper[64];
+  int i;
+
+  for (i = 0; name[i] && (i < 63); i++) {
+    upper[i] = toupper ((unsigned char) name[i]);
+  }
+  upper[i] = '\0';
+  fprintf (file, "/**\n * @desc    %s - generated by img2pcd from %s, do not edit\n", name, source);
+  fprintf (file, " *          %s%s, %d x %d, vertical-byte banks\n",
+           (planes == 2) ? "2 gray planes (weight 2, weight 1)" : "1 bpp", rle ? ", PCD8544 RLE" : "", w, h);
+  fprintf (file, " */\n#ifndef __%s_H__\n#define __%s_H__\n\n", upper, upper);
+  fprintf (file, "  #include <stdint.h>\n  #include <avr/pgmspace.h>\n\n");
+  fprintf (file, "  #define %s_X       %d\n", upper, x);
+  fprintf (file, "  #define %s_Y       %d\n", upper, y);
+  fprintf (file, "  #define %s_WIDTH   %d\n", upper, w);
+  fprintf (file, "  #define %s_HEIGHT  %d\n", upper, h);
+  fprintf (file, "  #define %s_SIZE    %d\n", upper, len);
+  fprintf (file, "  #define %s_BANK    %d\n", upper, y >> 3);
+  fprintf (file, "  #define %s_RLE     %d\n\n", upper, rle);
+  fprintf (file, "  static const uint8_t %s[] PROGMEM = {", name);
+  for (i = 0; i < len; i++) {
+    fprintf (file, "%s0x%02x%s", (i % 12) ? " " : "\n    ", data[i], (i < len - 1) ? "," : "");
+  }
+  fprintf (file, "\n  };\n\n#endif\n");
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   int
+ * @param   char **
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  const char *usage = "usage: img2pcd [-n name] [-d threshold|ordered|fs] [-t level] [-i] [-c] [-r] [-g] in out.h\n";
+  char name[64] = "";
+  int mode = DITHER_FS, threshold = 128;
+  int invert = 0, crop = 0, rle = 0, levels = 2;
+  int x0, y0, x1, y1, x, y, i, len;
+  const char *in, *out, *base;
+  uint8_t *packed, *data;
+  Image image;
+  FILE *file;
+
+  // options
+  for (i = 1; (i < argc) && (argv[i][0] == '-'); i++) {
+    if (!strcmp (argv[i], "-n") && (i + 1 < argc)) {
+      snprintf (name, sizeof(name), "%s", argv[++i]);
+    } else if (!strcmp (argv[i], "-d") && (i + 1 < argc)) {
+      i++;
+      if (!strcmp (argv[i], "threshold")) {
+        mode = DITHER_THRESHOLD;
+      } else if (!strcmp (argv[i], "ordered")) {
+        mode = DITHER_ORDERED;
+      } else if (!strcmp (argv[i], "fs")) {
+        mode = DITHER_FS;
+      } else {
+        fputs (usage, stderr);
+        return 2;
+      }
+    } else if (!strcmp (argv[i], "-t") && (i + 1 < argc)) {
+      threshold = atoi (argv[++i]);
+    } else if (!strcmp (argv[i], "-i")) {
+      invert = 1;
+    } else if (!strcmp (argv[i], "-c")) {
+      crop = 1;
+    } else if (!strcmp (argv[i], "-r")) {
+      rle = 1;
+    } else if (!strcmp (argv[i], "-g")) {
+      levels = 4;
+    } else {
+      fputs (usage, stderr);
+      return 2;
+    }
+  }
+  if (argc - i != 2) {
+    fputs (usage, stderr);
+    return 2;
+  }
+  in = argv[i];
+  out = argv[i + 1];
+  // array name from file name - identifier characters only
+  if (!name[0]) {
+    base = strrchr (in, '/') ? strrchr (in, '/') + 1 : in;
+    for (i = 0; base[i] && (base[i] != '.') && (i < 63); i++) {
+      name[i] = isalnum ((unsigned char) base[i]) ? base[i] : '_';
+    }
+    name[i] = '\0';
+    if (!name[0] || isdigit ((unsigned char) name[0])) {
+      name[0] = '_';
+    }
+  }
+  // darkness
+  if (IMG_Load (in, &image)) {
+    return 1;
+  }
+  if (invert) {
+    for (i = 0; i < image.width * image.height; i++) {
+      image.pixels[i] = 255 - image.pixels[i];
+    }
+  }
+  // levels
+  IMG_Dither (&image, levels, mode, threshold);
+  // bounding box of set pixels
+  x0 = 0;
+  y0 = 0;
+  x1 = image.width - 1;
+  y1 = image.height - 1;
+  if (crop) {
+    x0 = image.width;
+    y0 = image.height;
+    x1 = -1;
+    y1 = -1;
+    for (y = 0; y < image.height; y++) {
+      for (x = 0; x < image.width; x++) {
+        if (image.pixels[y * image.width + x]) {
+          x0 = (x < x0) ? x : x0;
+          y0 = (y < y0) ? y : y0;
+          x1 = (x > x1) ? x : x1;
+          y1 = (y > y1) ? y : y1;
+        }
+      }
+    }
+    // blank image
+    if (x1 < 0) {
+      fprintf (stderr, "img2pcd: %s has no set pixel to crop to\n", in);
+      return 1;
+    }
+    // streamed image starts on bank boundary
+    if (rle) {
+      y0 &= ~0x07;
+    }
+  }
+  if ((x1 - x0 + 1 > 255) || (y1 - y0 + 1 > 255)) {
+    fprintf (stderr, "img2pcd: %s is larger than 255 x 255\n", in);
+    return 1;
+  }
+  // vertical-byte banks
+  packed = malloc ((size_t) 2 * ((y1 - y0 + 8) / 8) * (x1 - x0 + 1));
+  len = IMG_Pack (&image, x0, y0, x1 - x0 + 1, y1 - y0 + 1, (levels == 4) ? 2 : 1, packed);
+  data = packed;
+  // compression
+  if (rle) {
+    data = malloc (len + len / RLE_LITERAL_MAX + 1);
+    len = IMG_Rle (packed, len, data);
+  }
+  // header
+  file = fopen (out, "w");
+  if (!file) {
+    fprintf (stderr, "img2pcd: cannot write %s\n", out);
+    return 1;
+  }
+  IMG_Write (file, name, in, data, len, x0, y0, x1 - x0 + 1, y1 - y0 + 1, rle, (levels == 4) ? 2 : 1);
+  fclose (file);
+  return 0;
+}